@@ -10,16 +10,43 @@
  */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 {
+#ifdef BT_NODE_CACHE
+    binary_tree_t *new_node = binary_tree_cache_alloc();
+#else
     binary_tree_t *new_node = malloc(sizeof(binary_tree_t));
+#endif
 
     if (new_node == NULL)
         return (NULL);
 
+    BT_STAT_ADD(allocs, 1);
     new_node->n = value;
-    new_node->parent = parent;
+    BT_SET_PARENT(new_node, parent);
     new_node->left = NULL;
     new_node->right = NULL;
+#ifdef BT_TOMBSTONE
+    new_node->deleted = 0;
+#endif
+#ifdef BT_MULTISET
+    new_node->count = 1;
+#endif
+    BT_UPDATE(new_node);
 
     return (new_node);
 }
 
+/**
+ * binary_tree_node_free - Releases a node created by binary_tree_node
+ * @node: Pointer to the node, may come from any thread
+ */
+void binary_tree_node_free(binary_tree_t *node)
+{
+    if (node != NULL)
+        BT_STAT_ADD(frees, 1);
+#ifdef BT_NODE_CACHE
+    if (node != NULL)
+        binary_tree_cache_free(node);
+#else
+    free(node);
+#endif
+}
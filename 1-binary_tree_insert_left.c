@@ -23,7 +23,7 @@ binary_tree_t *binary_tree_insert_left(binary_tree_t *parent, int value)
     if (parent->left != NULL)
     {
         new_node->left = parent->left;
-        new_node->left->parent = new_node;
+        BT_SET_PARENT(new_node->left, new_node);
     }
     parent->left = new_node;
 
@@ -2,6 +2,9 @@
 #include <stdio.h>
 #include "binary_trees.h"
 
+static int is_complete_helper(const binary_tree_t *tree, size_t index,
+			      size_t size, size_t height);
+
 /**
  * binary_tree_height - Measures the height of a binary tree
  * @tree: Pointer to the root node of the tree to measure the height.
@@ -63,7 +66,7 @@ int binary_tree_is_complete(const binary_tree_t *tree)
  *
  * Return: 1 if the tree is complete, 0 otherwise.
  */
-int is_complete_helper(const binary_tree_t *tree, size_t index, size_t size, size_t height)
+static int is_complete_helper(const binary_tree_t *tree, size_t index, size_t size, size_t height)
 {
 	if (tree == NULL)
 		return (1);
@@ -12,6 +12,7 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
     if (tree == NULL || tree->right == NULL)
         return (NULL);
 
+    BT_STAT_ADD(rotations, 1);
     pivot = tree->right;
     new_root = pivot;
     tree->right = pivot->left;
@@ -19,7 +20,16 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
         pivot->left->parent = tree;
     pivot->left = tree;
     pivot->parent = tree->parent;
+    if (pivot->parent != NULL)
+    {
+        if (pivot->parent->left == tree)
+            pivot->parent->left = pivot;
+        else
+            pivot->parent->right = pivot;
+    }
     tree->parent = pivot;
+    BT_UPDATE(tree);
+    BT_UPDATE(pivot);
 
     return (new_root);
 }
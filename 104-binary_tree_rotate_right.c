@@ -13,6 +13,7 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
     if (tree == NULL || tree->left == NULL)
         return (NULL);
 
+    BT_STAT_ADD(rotations, 1);
     new_root = tree->left;
     temp = new_root->right;
 
@@ -32,6 +33,9 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
     if (temp != NULL)
         temp->parent = tree;
 
+    BT_UPDATE(tree);
+    BT_UPDATE(new_root);
+
     return (new_root);
 }
 
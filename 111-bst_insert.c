@@ -1,46 +1,74 @@
 #include "binary_trees.h"
 
 /**
- * bst_insert - Inserts a value in a Binary Search Tree
- * @tree: Double pointer to the root node of the BST to insert the value
+ * bst_insert_at - Inserts a value below a node of known depth
+ * @tree: Double pointer to the node to insert under
  * @value: Value to store in the node to be inserted
+ * @depth: Depth of *tree, root is 1, for BT_STAT_DEPTH
  *
  * Return: Pointer to the created node, or NULL on failure
  */
-bst_t *bst_insert(bst_t **tree, int value)
+static bst_t *bst_insert_at(bst_t **tree, int value, size_t depth)
 {
-    if (*tree == NULL)
-    {
-        *tree = binary_tree_node(NULL, value);
-        return (*tree);
-    }
+    bst_t *new_node;
 
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
     if (value < (*tree)->n)
     {
         if ((*tree)->left == NULL)
         {
             (*tree)->left = binary_tree_node(*tree, value);
-            return ((*tree)->left);
+            new_node = (*tree)->left;
+            if (new_node != NULL)
+                BT_STAT_DEPTH(depth + 1);
         }
         else
         {
-            return (bst_insert(&((*tree)->left), value));
+            new_node = bst_insert_at(&((*tree)->left), value, depth + 1);
         }
     }
-    else if (value > (*tree)->n)
+    else if (BT_STAT_ADD(comparisons, 1), value > (*tree)->n)
     {
         if ((*tree)->right == NULL)
         {
             (*tree)->right = binary_tree_node(*tree, value);
-            return ((*tree)->right);
+            new_node = (*tree)->right;
+            if (new_node != NULL)
+                BT_STAT_DEPTH(depth + 1);
         }
         else
         {
-            return (bst_insert(&((*tree)->right), value));
+            new_node = bst_insert_at(&((*tree)->right), value, depth + 1);
         }
     }
+    else
+    {
+        /* Value already exists, ignore */
+        return (NULL);
+    }
 
-    /* Value already exists, ignore */
-    return (NULL);
+    if (new_node != NULL)
+        BT_UPDATE(*tree);
+    return (new_node);
 }
 
+/**
+ * bst_insert - Inserts a value in a Binary Search Tree
+ * @tree: Double pointer to the root node of the BST to insert the value
+ * @value: Value to store in the node to be inserted
+ *
+ * Return: Pointer to the created node, or NULL on failure
+ */
+bst_t *bst_insert(bst_t **tree, int value)
+{
+    if (*tree == NULL)
+    {
+        *tree = binary_tree_node(NULL, value);
+        if (*tree != NULL)
+            BT_STAT_DEPTH(1);
+        return (*tree);
+    }
+
+    return (bst_insert_at(tree, value, 1));
+}
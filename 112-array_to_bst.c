@@ -5,6 +5,9 @@
  * @array: pointer to the first element of the array to be converted
  * @size: number of element in the array
  *
+ * Description: duplicates are skipped, or counted with BT_MULTISET. On
+ * allocation failure the nodes built so far are freed.
+ *
  * Return: pointer to the root node of the created BST, or NULL on failure
  */
 bst_t *array_to_bst(int *array, size_t size)
@@ -17,10 +20,17 @@ bst_t *array_to_bst(int *array, size_t size)
 
     for (i = 0; i < size; i++)
     {
-        if (bst_insert(&root, array[i]) == NULL)
+#ifdef BT_MULTISET
+        if (bst_multi_insert(&root, array[i]) == NULL)
+#else
+        if (bst_insert(&root, array[i]) == NULL &&
+            bst_search(root, array[i]) == NULL)
+#endif
+        {
+            binary_tree_delete(root);
             return (NULL);
+        }
     }
 
     return (root);
 }
-
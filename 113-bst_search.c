@@ -8,15 +8,25 @@
  */
 bst_t *bst_search(const bst_t *tree, int value)
 {
-    if (tree == NULL)
-        return NULL;
+    size_t depth;
 
-    if (tree->n == value)
-        return (bst_t *)tree;
+    for (depth = 1; tree != NULL; depth++)
+    {
+        BT_STAT_ADD(visits, 1);
+        BT_STAT_ADD(comparisons, 1);
+        if (tree->n == value)
+        {
+            BT_STAT_DEPTH(depth);
+            return (bst_t *)tree;
+        }
 
-    if (value < tree->n)
-        return bst_search(tree->left, value);
-    else
-        return bst_search(tree->right, value);
+        BT_STAT_ADD(comparisons, 1);
+        if (value < tree->n)
+            tree = tree->left;
+        else
+            tree = tree->right;
+    }
+
+    return NULL;
 }
 
@@ -6,35 +6,53 @@
  * @root: Pointer to the root node of the tree
  * @value: Value to be removed from the tree
  *
+ * Description: parent links of the spliced children are kept in sync;
+ * the function never reads them, so it also works with BT_NO_PARENT.
+ *
  * Return: Pointer to the new root node of the tree after removal
  */
 bst_t *bst_remove(bst_t *root, int value)
 {
+    bst_t *temp;
+
     if (root == NULL)
         return NULL;
 
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
     if (value < root->n)
+    {
         root->left = bst_remove(root->left, value);
-    else if (value > root->n)
+        if (root->left != NULL)
+            BT_SET_PARENT(root->left, root);
+    }
+    else if (BT_STAT_ADD(comparisons, 1), value > root->n)
+    {
         root->right = bst_remove(root->right, value);
+        if (root->right != NULL)
+            BT_SET_PARENT(root->right, root);
+    }
     else {
-        if (root->left == NULL) {
-            bst_t *temp = root->right;
-            free(root);
-            return temp;
-        } else if (root->right == NULL) {
-            bst_t *temp = root->left;
-            free(root);
+        if (root->left == NULL || root->right == NULL) {
+            temp = root->left != NULL ? root->left : root->right;
+            if (temp != NULL)
+                BT_SET_PARENT(temp, NULL);
+            binary_tree_node_free(root);
             return temp;
         }
 
-        bst_t *temp = root->right;
+        temp = root->right;
         while (temp->left != NULL)
             temp = temp->left;
 
         root->n = temp->n;
+#ifdef BT_MULTISET
+        root->count = temp->count;
+#endif
         root->right = bst_remove(root->right, temp->n);
+        if (root->right != NULL)
+            BT_SET_PARENT(root->right, root);
     }
+    BT_UPDATE(root);
     return root;
 }
-
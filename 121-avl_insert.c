@@ -1,42 +1,82 @@
 #include "binary_trees.h"
 
+/**
+ * avl_rebalance - Restores the AVL property at one node
+ * @node: Pointer to the node, whose subtrees are valid AVL trees differing
+ *        in height by at most 2
+ *
+ * Description: single or double rotation towards the shorter side, then
+ * BT_UPDATE. The parent's child link is fixed by the rotation functions.
+ *
+ * Return: Pointer to the node now at the position of @node
+ */
+avl_t *avl_rebalance(avl_t *node)
+{
+    int balance = BT_HEIGHT(node->left) - BT_HEIGHT(node->right);
+
+    if (balance > 1)
+    {
+        if (BT_HEIGHT(node->left->left) < BT_HEIGHT(node->left->right))
+            binary_tree_rotate_left(node->left);
+        return (binary_tree_rotate_right(node));
+    }
+    if (balance < -1)
+    {
+        if (BT_HEIGHT(node->right->right) < BT_HEIGHT(node->right->left))
+            binary_tree_rotate_right(node->right);
+        return (binary_tree_rotate_left(node));
+    }
+    BT_UPDATE(node);
+
+    return (node);
+}
+
 /**
  * avl_insert - Inserts a value in an AVL Tree
  * @tree: Pointer to the root of the AVL tree
  * @value: Value to insert in the AVL tree
- * Return: Pointer to the created node, or NULL on failure
+ *
+ * Description: inserts as a leaf, then rebalances every ancestor on the
+ * way back to the root, so the tree stays within 1.44 log2(n) in height.
+ *
+ * Return: Pointer to the created node, the node already holding @value,
+ * or NULL on failure
  */
 avl_t *avl_insert(avl_t **tree, int value)
 {
+    avl_t *parent = NULL, **link, *new_node, *node, *top;
+    size_t depth = 1;
+
     if (!tree)
         return (NULL);
 
-    if (!*tree)
+    link = tree;
+    for (; *link != NULL; depth++)
     {
-        *tree = binary_tree_node(NULL, value);
-        if (!*tree)
-            return (NULL);
-        return (*tree);
+        parent = *link;
+        BT_STAT_ADD(visits, 1);
+        BT_STAT_ADD(comparisons, 1);
+        if (value < parent->n)
+            link = &parent->left;
+        else if (BT_STAT_ADD(comparisons, 1), value > parent->n)
+            link = &parent->right;
+        else
+            return (parent);
     }
 
-    if (value < (*tree)->n)
-    {
-        (*tree)->left = avl_insert(&((*tree)->left), value);
-        if (!(*tree)->left)
-            return (NULL);
-    }
-    else if (value > (*tree)->n)
-    {
-        (*tree)->right = avl_insert(&((*tree)->right), value);
-        if (!(*tree)->right)
-            return (NULL);
-    }
-    else
+    new_node = binary_tree_node(parent, value);
+    if (!new_node)
+        return (NULL);
+    *link = new_node;
+    BT_STAT_DEPTH(depth);
+
+    for (node = parent; node != NULL; node = parent)
     {
-        /* Value already exists, ignore */
-        return (*tree);
+        parent = node->parent;
+        top = avl_rebalance(node);
+        if (parent == NULL)
+            *tree = top;
     }
 
-    return (*tree);
+    return (new_node);
 }
-
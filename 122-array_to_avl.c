@@ -5,6 +5,9 @@
  * @array: Pointer to the first element of the array to be converted
  * @size: Number of elements in the array
  *
+ * Description: duplicates are skipped. On allocation failure the nodes
+ * built so far are freed.
+ *
  * Return: Pointer to the root node of the created AVL tree, or NULL on failure
  */
 avl_t *array_to_avl(int *array, size_t size)
@@ -18,7 +21,10 @@ avl_t *array_to_avl(int *array, size_t size)
     for (i = 0; i < size; i++)
     {
         if (avl_insert(&root, array[i]) == NULL)
+        {
+            binary_tree_delete(root);
             return (NULL);
+        }
     }
 
     return (root);
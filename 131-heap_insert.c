@@ -1,15 +1,138 @@
 #include "binary_trees.h"
 
 /**
- * heap_insert - Inserts a value in a Max Binary Heap
+ * heap_size - Measures the size of a complete binary tree
+ * @root: Pointer to the root node of the heap
+ *
+ * Description: one of the two subtrees of a complete tree is perfect,
+ * comparing the left spines tells which, so only one path is walked.
+ *
+ * Return: Number of nodes, in O(log^2 n)
+ */
+size_t heap_size(const heap_t *root)
+{
+    const heap_t *node;
+    size_t size = 0, left_h, right_h;
+
+    while (root != NULL)
+    {
+        for (left_h = 0, node = root->left; node != NULL; node = node->left)
+            left_h++;
+        for (right_h = 0, node = root->right; node != NULL; node = node->left)
+            right_h++;
+        if (left_h == right_h)
+        {
+            size += (size_t)1 << left_h;
+            root = root->right;
+        }
+        else
+        {
+            size += (size_t)1 << right_h;
+            root = root->left;
+        }
+    }
+
+    return (size);
+}
+
+/**
+ * heap_node_at - Finds a node of a complete binary tree by position
+ * @root: Pointer to the root node of the heap
+ * @index: 1-based level-order index of the node
+ *
+ * Return: Pointer to the node, or NULL if there is no such node
+ */
+heap_t *heap_node_at(heap_t *root, size_t index)
+{
+    size_t bit = 1;
+
+    if (index == 0)
+        return (NULL);
+
+    while (bit <= index >> 1)
+        bit <<= 1;
+    for (bit >>= 1; root != NULL && bit != 0; bit >>= 1)
+        root = (index & bit) ? root->right : root->left;
+
+    return (root);
+}
+
+/**
+ * heap_swap_up - Swaps a node with its parent, moving the nodes themselves
+ * @root: Pointer to the root node of the heap
+ * @node: Pointer to the node to move up one level
+ *
+ * Description: values never move between nodes, so a pointer returned by
+ * heap_insert keeps designating the same value and can be used as a handle.
+ */
+void heap_swap_up(heap_t **root, heap_t *node)
+{
+    heap_t *parent = node->parent, *grand = parent->parent;
+    heap_t *left = node->left, *right = node->right;
+
+    if (parent->left == node)
+    {
+        node->left = parent;
+        node->right = parent->right;
+        if (node->right != NULL)
+            node->right->parent = node;
+    }
+    else
+    {
+        node->right = parent;
+        node->left = parent->left;
+        if (node->left != NULL)
+            node->left->parent = node;
+    }
+    parent->left = left;
+    parent->right = right;
+    if (left != NULL)
+        left->parent = parent;
+    if (right != NULL)
+        right->parent = parent;
+    parent->parent = node;
+    node->parent = grand;
+
+    if (grand == NULL)
+        *root = node;
+    else if (grand->left == parent)
+        grand->left = node;
+    else
+        grand->right = node;
+}
+
+/**
+ * heapify_up - Restores the HEAP_HIGHER order above a node
+ * @root: Pointer to the root node of the heap
+ * @node: Pointer to the node whose value may belong higher up
+ *
+ * Return: @node, which keeps its value
+ */
+heap_t *heapify_up(heap_t **root, heap_t *node)
+{
+    while (node->parent != NULL &&
+           (BT_STAT_ADD(comparisons, 1), HEAP_HIGHER(node->n, node->parent->n)))
+        heap_swap_up(root, node);
+
+    return (node);
+}
+
+/**
+ * heap_insert - Inserts a value in a Binary Heap ordered by HEAP_HIGHER
  * @root: Pointer to the root node of the Heap
  * @value: The value to store in the node to be inserted
  *
- * Return: Pointer to the inserted node, or NULL on failure
+ * Description: the heap stores no node count, so heap_size locates the
+ * new position, in O(log^2 n), before an O(log n) sift up.
+ *
+ * Return: Pointer to the inserted node, or NULL on failure. The node keeps
+ * its value until it is removed, so it can be passed to heap_update_key and
+ * heap_remove.
  */
 heap_t *heap_insert(heap_t **root, int value)
 {
     heap_t *new_node, *parent;
+    size_t index, depth;
 
     if (!root)
         return (NULL);
@@ -21,19 +144,22 @@ heap_t *heap_insert(heap_t **root, int value)
     if (!*root)
     {
         *root = new_node;
+        BT_STAT_DEPTH(1);
         return (new_node);
     }
 
-    parent = find_parent(*root);
+    index = heap_size(*root) + 1;
+    parent = heap_node_at(*root, index / 2);
     new_node->parent = parent;
 
-    if (!parent->left)
+    if (index % 2 == 0)
         parent->left = new_node;
     else
         parent->right = new_node;
 
-    heapify_up(new_node);
-
-    return (new_node);
+    /* The depth of position index is its number of bits */
+    for (depth = 1; index >> depth != 0; depth++)
+        ;
+    BT_STAT_DEPTH(depth);
+    return (heapify_up(root, new_node));
 }
-
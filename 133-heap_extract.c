@@ -2,9 +2,13 @@
 #include <stdlib.h>
 
 /**
- * heap_extract - extracts the root node of a Max Binary Heap
+ * heap_extract - extracts the root node of a Binary Heap ordered by
+ *                HEAP_HIGHER
  * @root: double pointer to the root node of the heap
  *
+ * Description: heap_size finds the last node in O(log^2 n), which
+ * dominates the O(log n) sift down.
+ *
  * Return: value stored in the root node, or 0 on failure
  */
 int heap_extract(heap_t **root)
@@ -16,10 +20,10 @@ int heap_extract(heap_t **root)
         return (0);
 
     value = (*root)->n;
-    last_node = get_last_node(*root);
+    last_node = heap_node_at(*root, heap_size(*root));
 
     if (*root == last_node) {
-        free(*root);
+        binary_tree_node_free(*root);
         *root = NULL;
         return (value);
     }
@@ -40,56 +44,33 @@ int heap_extract(heap_t **root)
     if (last_node->right)
         last_node->right->parent = last_node;
 
-    free(temp);
+    binary_tree_node_free(temp);
 
-    heapify_down(*root);
+    heapify_down(root, *root);
 
     return (value);
 }
 
 /**
- * get_last_node - returns the last node of a binary tree
- * @root: pointer to the root node of the tree
- *
- * Return: pointer to the last node, or NULL if root is NULL
- */
-heap_t *get_last_node(heap_t *root)
-{
-    if (!root)
-        return (NULL);
-
-    while (root->left || root->right) {
-        if (root->right)
-            root = root->right;
-        else
-            root = root->left;
-    }
-
-    return (root);
-}
-
-/**
- * heapify_down - restores the max heap property after extracting the root node
- * @root: pointer to the root node of the heap
+ * heapify_down - Restores the HEAP_HIGHER order below a node
+ * @root: Pointer to the root node of the heap
+ * @node: Pointer to the node whose value may belong lower down
  */
-void heapify_down(heap_t *root)
+void heapify_down(heap_t **root, heap_t *node)
 {
-    heap_t *largest, *temp;
-
-    if (!root)
-        return;
-
-    largest = root;
-    if (root->left && root->left->n > largest->n)
-        largest = root->left;
-    if (root->right && root->right->n > largest->n)
-        largest = root->right;
-
-    if (largest != root) {
-        temp = largest->n;
-        largest->n = root->n;
-        root->n = temp;
-        heapify_down(largest);
+    heap_t *best;
+
+    while (node != NULL)
+    {
+        BT_STAT_ADD(visits, 1);
+        BT_STAT_ADD(comparisons, (node->left != NULL) + (node->right != NULL));
+        best = node;
+        if (node->left && HEAP_HIGHER(node->left->n, best->n))
+            best = node->left;
+        if (node->right && HEAP_HIGHER(node->right->n, best->n))
+            best = node->right;
+        if (best == node)
+            break;
+        heap_swap_up(root, best);
     }
 }
-
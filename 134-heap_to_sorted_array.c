@@ -2,7 +2,8 @@
 #include "binary_trees.h"
 
 /**
- * heap_extract - Extracts the root value of a Max Binary Heap
+ * heap_to_sorted_array - Empties a Binary Heap into an array sorted in
+ *                        HEAP_HIGHER order, the top value first
  * @heap: Pointer to the root node of the heap
  * @size: Pointer to store the size of the array
  * Return: Pointer to the sorted array
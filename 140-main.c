@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point, build with -DBT_NO_PARENT to get the compact nodes
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    printf("Node size: %lu bytes\n", (unsigned long)sizeof(bst_t));
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+
+    printf("Search 62: %s\n", bst_search(tree, 62) ? "found" : "not found");
+    tree = bst_remove(tree, 79);
+    printf("Removed 79...\n");
+    binary_tree_print(tree);
+    printf("Search 79: %s\n", bst_search(tree, 79) ? "found" : "not found");
+    binary_tree_delete(tree);
+    return (0);
+}
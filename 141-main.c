@@ -0,0 +1,64 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "binary_trees_generic.h"
+
+/**
+ * struct tag_s - Fixed-width byte key
+ *
+ * @b: Raw key bytes, compared lexicographically
+ */
+typedef struct tag_s
+{
+    unsigned char b[8];
+} tag_t;
+
+#define TAG_LESS(x, y) (memcmp((x).b, (y).b, sizeof((x).b)) < 0)
+
+BT_DEFINE_BST(id_bst, unsigned long, BT_LESS)
+BT_DEFINE_BST(tag_bst, tag_t, TAG_LESS)
+BT_DEFINE_HEAP(dmin_heap, double, BT_LESS)
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    unsigned long ids[] = {9000000000UL, 42UL, 7000000001UL, 3UL};
+    double lat[] = {3.5, 0.25, 12.0, 1.75, 0.5};
+    const char *names[] = {"gamma", "alpha", "delta", "beta"};
+    id_bst_t *ids_tree = NULL;
+    tag_bst_t *tags = NULL;
+    dmin_heap_t *heap = NULL;
+    tag_t tag;
+    double d;
+    size_t i;
+
+    for (i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+        id_bst_insert(&ids_tree, ids[i]);
+    printf("Search 7000000001: %s\n",
+           id_bst_search(ids_tree, 7000000001UL) ? "found" : "not found");
+    ids_tree = id_bst_remove(ids_tree, 7000000001UL);
+    printf("Search 7000000001: %s\n",
+           id_bst_search(ids_tree, 7000000001UL) ? "found" : "not found");
+
+    for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        memset(&tag, 0, sizeof(tag));
+        strncpy((char *)tag.b, names[i], sizeof(tag.b));
+        tag_bst_insert(&tags, tag);
+    }
+    printf("Smallest tag: %s\n", (char *)tags->left->n.b);
+
+    for (i = 0; i < sizeof(lat) / sizeof(lat[0]); i++)
+        dmin_heap_insert(&heap, lat[i]);
+    printf("Heap size: %lu\n", (unsigned long)dmin_heap_size(heap));
+    while (dmin_heap_extract(&heap, &d))
+        printf("Extracted: %g\n", d);
+
+    id_bst_delete(ids_tree);
+    tag_bst_delete(tags);
+    return (0);
+}
@@ -0,0 +1,85 @@
+#include "binary_trees.h"
+
+/**
+ * bst_select - Finds the node holding the k-th smallest value of a BST
+ * @tree: Pointer to the root node of the BST
+ * @k: Zero-based rank of the value to find
+ *
+ * Return: Pointer to the node, or NULL if tree is NULL or k is out of range
+ */
+bst_t *bst_select(const bst_t *tree, size_t k)
+{
+    size_t left_size;
+
+    while (tree != NULL)
+    {
+        left_size = BT_SIZE(tree->left);
+        if (k == left_size)
+            return ((bst_t *)tree);
+        if (k < left_size)
+        {
+            tree = tree->left;
+        }
+        else
+        {
+            k -= left_size + 1;
+            tree = tree->right;
+        }
+    }
+
+    return (NULL);
+}
+
+/**
+ * bst_rank - Counts the values of a BST that are smaller than a value
+ * @tree: Pointer to the root node of the BST
+ * @value: Value to rank, it does not need to be in the tree
+ *
+ * Return: Number of values strictly smaller than value
+ */
+size_t bst_rank(const bst_t *tree, int value)
+{
+    size_t rank = 0;
+
+    while (tree != NULL)
+    {
+        if (value <= tree->n)
+        {
+            tree = tree->left;
+        }
+        else
+        {
+            rank += BT_SIZE(tree->left) + 1;
+            tree = tree->right;
+        }
+    }
+
+    return (rank);
+}
+
+/**
+ * bst_percentile - Finds the nearest-rank percentile of a BST
+ * @tree: Pointer to the root node of the BST
+ * @percent: Percentile to find, between 0 and 100
+ *
+ * Return: Pointer to the node holding the percentile, or NULL if tree is
+ * NULL or percent is out of range
+ */
+bst_t *bst_percentile(const bst_t *tree, double percent)
+{
+    size_t size, k;
+    double pos;
+
+    if (tree == NULL || !(percent >= 0.0 && percent <= 100.0))
+        return (NULL);
+
+    size = BT_SIZE(tree);
+    pos = percent / 100.0 * (double)size;
+    k = (size_t)pos;
+    if ((double)k < pos)
+        k++;
+    if (k > 0)
+        k--;
+
+    return (bst_select(tree, k));
+}
@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point, build with -DBT_ORDER_STATS for O(log n) queries
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+
+    printf("Smallest: %d\n", bst_select(tree, 0)->n);
+    printf("5th smallest: %d\n", bst_select(tree, 4)->n);
+    printf("Rank of 62: %lu\n", (unsigned long)bst_rank(tree, 62));
+    printf("p50: %d\n", bst_percentile(tree, 50.0)->n);
+    printf("p99: %d\n", bst_percentile(tree, 99.0)->n);
+
+    tree = bst_remove(tree, 1);
+    printf("Removed 1...\n");
+    printf("Smallest: %d\n", bst_select(tree, 0)->n);
+    printf("Rank of 62: %lu\n", (unsigned long)bst_rank(tree, 62));
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include "binary_trees_concurrent.h"
+
+/**
+ * cbst_init - Initialises an empty concurrent Binary Search Tree
+ * @tree: Pointer to the tree to initialise
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int cbst_init(cbst_t *tree)
+{
+    if (tree == NULL)
+        return (-1);
+
+    memset(tree, 0, sizeof(*tree));
+    tree->epoch = 1;
+    if (pthread_mutex_init(&tree->lock, NULL) != 0)
+        return (-1);
+
+    return (0);
+}
+
+/**
+ * cbst_destroy - Frees every node of a concurrent Binary Search Tree
+ * @tree: Pointer to the tree, no thread may be using it any more
+ */
+void cbst_destroy(cbst_t *tree)
+{
+    bst_t *next;
+
+    if (tree == NULL)
+        return;
+
+    binary_tree_delete(tree->root);
+    tree->root = NULL;
+    while (tree->retired != NULL)
+    {
+        next = tree->retired->parent;
+        binary_tree_node_free(tree->retired);
+        tree->retired = next;
+    }
+    tree->n_retired = 0;
+    pthread_mutex_destroy(&tree->lock);
+}
+
+/**
+ * cbst_synchronize - Waits for readers and frees the retired nodes
+ * @tree: Pointer to the tree, the caller must hold the writer lock
+ *
+ * Description: advances the epoch, then waits until no reader is still in
+ * a section that began before it. Such readers may hold a retired node;
+ * later ones cannot reach it since it was unlinked before the epoch moved.
+ */
+void cbst_synchronize(cbst_t *tree)
+{
+    unsigned long epoch, seen;
+    bst_t *next;
+    size_t i;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    epoch = __atomic_add_fetch(&tree->epoch, 1, __ATOMIC_SEQ_CST);
+    for (i = 0; i < CBST_MAX_READERS; i++)
+    {
+        seen = __atomic_load_n(&tree->readers[i].epoch, __ATOMIC_ACQUIRE);
+        while (seen != 0 && seen < epoch)
+        {
+            sched_yield();
+            seen = __atomic_load_n(&tree->readers[i].epoch,
+                                   __ATOMIC_ACQUIRE);
+        }
+    }
+
+    while (tree->retired != NULL)
+    {
+        next = tree->retired->parent;
+        binary_tree_node_free(tree->retired);
+        tree->retired = next;
+    }
+    tree->n_retired = 0;
+}
+
+/**
+ * cbst_retire - Defers freeing of a node that has just been unlinked
+ * @tree: Pointer to the tree, the caller must hold the writer lock
+ * @node: Node no longer reachable from the root
+ *
+ * Description: readers never look at parent links, so the retired list is
+ * chained through them.
+ */
+void cbst_retire(cbst_t *tree, bst_t *node)
+{
+    node->parent = tree->retired;
+    tree->retired = node;
+    if (++tree->n_retired >= CBST_RETIRE_BATCH)
+        cbst_synchronize(tree);
+}
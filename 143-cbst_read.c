@@ -0,0 +1,99 @@
+#include "binary_trees_concurrent.h"
+
+/**
+ * cbst_reader_register - Hands a free reader slot to the calling thread
+ * @tree: Pointer to the tree
+ *
+ * Return: Slot to pass to cbst_read_lock, or -1 if all CBST_MAX_READERS
+ * slots are taken
+ */
+int cbst_reader_register(cbst_t *tree)
+{
+    int free_slot, i;
+
+    if (tree == NULL)
+        return (-1);
+
+    for (i = 0; i < CBST_MAX_READERS; i++)
+    {
+        free_slot = 0;
+        if (__atomic_compare_exchange_n(&tree->readers[i].used, &free_slot, 1,
+                                        0, __ATOMIC_ACQUIRE,
+                                        __ATOMIC_RELAXED))
+            return (i);
+    }
+
+    return (-1);
+}
+
+/**
+ * cbst_reader_unregister - Gives a reader slot back
+ * @tree: Pointer to the tree
+ * @reader: Slot returned by cbst_reader_register, outside a read section
+ */
+void cbst_reader_unregister(cbst_t *tree, size_t reader)
+{
+    if (tree == NULL || reader >= CBST_MAX_READERS)
+        return;
+
+    __atomic_store_n(&tree->readers[reader].used, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * cbst_read_lock - Enters a read section on a concurrent BST
+ * @tree: Pointer to the tree
+ * @reader: Slot returned by cbst_reader_register to the calling thread
+ *
+ * Description: only touches the caller's own slot, so readers scale with
+ * the number of cores. Nodes returned by cbst_search stay valid until the
+ * matching cbst_read_unlock.
+ *
+ * Return: 0 on success, -1 if @reader is not a registered slot
+ */
+int cbst_read_lock(cbst_t *tree, size_t reader)
+{
+    unsigned long epoch;
+
+    if (reader >= CBST_MAX_READERS ||
+        !__atomic_load_n(&tree->readers[reader].used, __ATOMIC_RELAXED))
+        return (-1);
+
+    epoch = __atomic_load_n(&tree->epoch, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&tree->readers[reader].epoch, epoch, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    return (0);
+}
+
+/**
+ * cbst_read_unlock - Leaves a read section on a concurrent BST
+ * @tree: Pointer to the tree
+ * @reader: Slot passed to cbst_read_lock
+ */
+void cbst_read_unlock(cbst_t *tree, size_t reader)
+{
+    __atomic_store_n(&tree->readers[reader].epoch, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * cbst_search - Searches for a value without taking any lock
+ * @tree: Pointer to the tree, the caller must be in a read section
+ * @value: The value to search in the tree
+ *
+ * Return: A pointer to the node containing the value, or NULL if not found
+ */
+const bst_t *cbst_search(const cbst_t *tree, int value)
+{
+    const bst_t *node;
+
+    node = __atomic_load_n(&tree->root, __ATOMIC_ACQUIRE);
+    while (node != NULL && node->n != value)
+    {
+        if (value < node->n)
+            node = __atomic_load_n(&node->left, __ATOMIC_ACQUIRE);
+        else
+            node = __atomic_load_n(&node->right, __ATOMIC_ACQUIRE);
+    }
+
+    return (node);
+}
@@ -0,0 +1,130 @@
+#include "binary_trees_concurrent.h"
+
+/**
+ * cbst_insert - Inserts a value in a concurrent Binary Search Tree
+ * @tree: Pointer to the tree
+ * @value: Value to store in the node to be inserted
+ *
+ * Description: the node is fully built before a release store links it,
+ * so a reader either misses it or sees it complete.
+ *
+ * Return: 1 if inserted, 0 if the value was already present, -1 on failure
+ */
+int cbst_insert(cbst_t *tree, int value)
+{
+    bst_t **link, *parent = NULL, *node;
+    int ret = 1;
+
+    pthread_mutex_lock(&tree->lock);
+    link = &tree->root;
+    while (*link != NULL && (*link)->n != value)
+    {
+        parent = *link;
+        link = value < parent->n ? &parent->left : &parent->right;
+    }
+
+    if (*link != NULL)
+    {
+        ret = 0;
+    }
+    else
+    {
+        node = binary_tree_node(parent, value);
+        if (node == NULL)
+            ret = -1;
+        else
+            __atomic_store_n(link, node, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&tree->lock);
+
+    return (ret);
+}
+
+/**
+ * cbst_unlink_two - Replaces a node with two children by a copy of its
+ *                   in-order successor, then unlinks the successor
+ * @tree: Pointer to the tree, the caller holds the writer lock
+ * @link: Link pointing to the node to remove
+ *
+ * Description: a reader that loaded the old node before the copy was
+ * published may still be heading down its right subtree for the
+ * successor's key, so the successor is only unlinked once those readers
+ * have left.
+ *
+ * Return: 1 on success, -1 if the copy could not be allocated
+ */
+static int cbst_unlink_two(cbst_t *tree, bst_t **link)
+{
+    bst_t *node = *link, **slink, *succ, *copy;
+
+    slink = &node->right;
+    while ((*slink)->left != NULL)
+        slink = &(*slink)->left;
+    succ = *slink;
+
+    copy = binary_tree_node(node->parent, succ->n);
+    if (copy == NULL)
+        return (-1);
+    copy->left = node->left;
+    copy->right = succ == node->right ? succ->right : node->right;
+    copy->left->parent = copy;
+    if (copy->right != NULL)
+        copy->right->parent = copy;
+    __atomic_store_n(link, copy, __ATOMIC_RELEASE);
+
+    if (succ != node->right)
+    {
+        cbst_synchronize(tree);
+        if (succ->right != NULL)
+            succ->right->parent = succ->parent;
+        __atomic_store_n(slink, succ->right, __ATOMIC_RELEASE);
+    }
+    cbst_retire(tree, node);
+    cbst_retire(tree, succ);
+
+    return (1);
+}
+
+/**
+ * cbst_remove - Removes a value from a concurrent Binary Search Tree
+ * @tree: Pointer to the tree
+ * @value: Value to remove
+ *
+ * Description: values of reachable nodes are never overwritten. A node
+ * with two children is replaced by a fresh copy of its successor, and the
+ * successor is unlinked after a grace period, so a concurrent reader finds
+ * every key that stays present.
+ *
+ * Return: 1 if removed, 0 if the value was absent, -1 on failure
+ */
+int cbst_remove(cbst_t *tree, int value)
+{
+    bst_t **link, *node, *child;
+    int ret = 1;
+
+    pthread_mutex_lock(&tree->lock);
+    link = &tree->root;
+    while (*link != NULL && (*link)->n != value)
+        link = value < (*link)->n ? &(*link)->left : &(*link)->right;
+
+    node = *link;
+    if (node == NULL)
+    {
+        ret = 0;
+    }
+    else if (node->left != NULL && node->right != NULL)
+    {
+        ret = cbst_unlink_two(tree, link);
+    }
+    else
+    {
+        child = node->left != NULL ? node->left : node->right;
+        if (child != NULL)
+            child->parent = node->parent;
+        __atomic_store_n(link, child, __ATOMIC_RELEASE);
+        cbst_retire(tree, node);
+    }
+    pthread_mutex_unlock(&tree->lock);
+
+    return (ret);
+}
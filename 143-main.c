@@ -0,0 +1,147 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "binary_trees_concurrent.h"
+
+#define NB_READERS 4
+#define NB_KEYS 1024
+#define NB_LOOKUPS 1000000
+
+static cbst_t tree;
+static unsigned long misses;
+
+/**
+ * reader - Looks up random keys without taking locks
+ * @arg: Seed of the reader, cast to a pointer
+ *
+ * Description: odd keys are never removed, so every lookup of one must
+ * hit even while the even keys around it are removed and reinserted.
+ *
+ * Return: Number of hits, cast to a pointer
+ */
+static void *reader(void *arg)
+{
+    size_t hits = 0, i;
+    unsigned int seed = (unsigned int)(size_t)arg + 1;
+    int key, slot;
+
+    slot = cbst_reader_register(&tree);
+    if (slot == -1)
+        return (NULL);
+    for (i = 0; i < NB_LOOKUPS; i++)
+    {
+        key = rand_r(&seed) % NB_KEYS;
+        cbst_read_lock(&tree, slot);
+        if (cbst_search(&tree, key) != NULL)
+            hits++;
+        else if (key % 2 == 1)
+            __atomic_add_fetch(&misses, 1, __ATOMIC_RELAXED);
+        cbst_read_unlock(&tree, slot);
+    }
+    cbst_reader_unregister(&tree, slot);
+
+    return ((void *)hits);
+}
+
+/**
+ * remover - Removes the root of the tree given as argument
+ * @arg: Pointer to a cbst_t
+ *
+ * Return: NULL
+ */
+static void *remover(void *arg)
+{
+    cbst_t *t = arg;
+
+    cbst_remove(t, t->root->n);
+    return (NULL);
+}
+
+/**
+ * stalled_reader - Checks that a reader stalled on a removed node still
+ *                  finds the successor that replaced it
+ *
+ * Description: the reader loads the root, the root is removed by another
+ * thread, then the reader finishes its descent from the old root, as a
+ * preempted cbst_search would.
+ *
+ * Return: 1 if the successor was found, 0 otherwise
+ */
+static int stalled_reader(void)
+{
+    int keys[] = {2, 1, 4, 3, 5}, found, slot;
+    cbst_t t;
+    pthread_t thread;
+    const bst_t *old, *node;
+    size_t i;
+
+    if (cbst_init(&t) != 0)
+        return (0);
+    for (i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+        cbst_insert(&t, keys[i]);
+
+    slot = cbst_reader_register(&t);
+    if (cbst_read_lock(&t, slot) != 0)
+    {
+        cbst_destroy(&t);
+        return (0);
+    }
+    old = __atomic_load_n(&t.root, __ATOMIC_ACQUIRE);
+    pthread_create(&thread, NULL, remover, &t);
+    while (__atomic_load_n(&t.root, __ATOMIC_ACQUIRE) == old)
+        usleep(1000);
+    usleep(10000);
+    node = old;
+    while (node != NULL && node->n != 3)
+        node = __atomic_load_n(3 < node->n ? &node->left : &node->right,
+                               __ATOMIC_ACQUIRE);
+    found = node != NULL;
+    cbst_read_unlock(&t, slot);
+    cbst_reader_unregister(&t, slot);
+
+    pthread_join(thread, NULL);
+    cbst_destroy(&t);
+    return (found);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    pthread_t threads[NB_READERS];
+    size_t i, hits = 0;
+    void *ret;
+    int round;
+
+    if (!stalled_reader())
+        misses++;
+    if (cbst_init(&tree) != 0)
+        return (1);
+    for (i = 0; i < NB_KEYS; i++)
+        cbst_insert(&tree, (int)(i * 7919 % NB_KEYS));
+
+    for (i = 0; i < NB_READERS; i++)
+        pthread_create(&threads[i], NULL, reader, (void *)i);
+    for (round = 0; round < 50; round++)
+    {
+        for (i = 0; i < NB_KEYS; i += 2)
+            cbst_remove(&tree, (int)i);
+        for (i = 0; i < NB_KEYS; i += 2)
+            cbst_insert(&tree, (int)i);
+    }
+    for (i = 0; i < NB_READERS; i++)
+    {
+        pthread_join(threads[i], &ret);
+        hits += (size_t)ret;
+    }
+
+    printf("Lookups: %d, hits: %lu\n", NB_READERS * NB_LOOKUPS,
+           (unsigned long)hits);
+    printf("Missed present keys: %lu\n", misses);
+    printf("Binary tree is BST: %d\n", binary_tree_is_bst(tree.root));
+    cbst_destroy(&tree);
+    return (misses != 0);
+}
@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "binary_trees_concurrent.h"
+
+/*
+ * Throughput of heap_mq_t against heap_t behind one global mutex.
+ *
+ * gcc -O2 -pthread 144-bench.c 144-heap_mq.c 144-heap_mq_ops.c \
+ *     131-heap_insert.c 133-heap_extract.c 0-binary_tree_node.c \
+ *     3-binary_tree_delete.c -o 144-bench
+ * ./144-bench [ops_per_thread] [max_threads]
+ *
+ * Each thread alternates one insert and one extract on a queue that is
+ * prefilled, which is the steady state of a scheduler. Output is CSV.
+ */
+
+#define PREFILL 100000
+
+/**
+ * struct bench_s - Shared benchmark state
+ *
+ * @mq: Concurrent queue under test
+ * @heap: Baseline heap
+ * @lock: Global lock of the baseline heap
+ * @ops: Insert/extract pairs per thread
+ * @use_mq: 1 to run against @mq, 0 against @heap
+ */
+typedef struct bench_s
+{
+    heap_mq_t mq;
+    heap_t *heap;
+    pthread_mutex_t lock;
+    size_t ops;
+    int use_mq;
+} bench_t;
+
+/**
+ * worker - Runs insert/extract pairs on the queue under test
+ * @arg: Pointer to the bench_t
+ *
+ * Return: Always NULL
+ */
+static void *worker(void *arg)
+{
+    bench_t *b = arg;
+    unsigned int seed = (unsigned int)(size_t)&seed;
+    size_t i;
+    int value;
+
+    for (i = 0; i < b->ops; i++)
+    {
+        if (b->use_mq)
+        {
+            heap_mq_insert(&b->mq, rand_r(&seed));
+            heap_mq_extract(&b->mq, &value);
+            continue;
+        }
+        pthread_mutex_lock(&b->lock);
+        heap_insert(&b->heap, rand_r(&seed));
+        pthread_mutex_unlock(&b->lock);
+        pthread_mutex_lock(&b->lock);
+        heap_extract(&b->heap);
+        pthread_mutex_unlock(&b->lock);
+    }
+
+    return (NULL);
+}
+
+/**
+ * run - Times one configuration and prints its CSV row
+ * @b: Pointer to the benchmark state
+ * @nb_threads: Number of worker threads
+ */
+static void run(bench_t *b, size_t nb_threads)
+{
+    pthread_t *threads = malloc(nb_threads * sizeof(*threads));
+    struct timespec t0, t1;
+    unsigned int seed = 1;
+    double secs;
+    size_t i;
+
+    if (threads == NULL)
+        return;
+    if (b->use_mq)
+        heap_mq_init(&b->mq, 2 * nb_threads);
+    b->heap = NULL;
+    for (i = 0; i < PREFILL; i++)
+    {
+        if (b->use_mq)
+            heap_mq_insert(&b->mq, rand_r(&seed));
+        else
+            heap_insert(&b->heap, rand_r(&seed));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < nb_threads; i++)
+        pthread_create(&threads[i], NULL, worker, b);
+    for (i = 0; i < nb_threads; i++)
+        pthread_join(threads[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("%s,%lu,%lu,%.6f,%.3f\n", b->use_mq ? "heap_mq" : "heap_t+mutex",
+           (unsigned long)nb_threads, (unsigned long)(2 * b->ops * nb_threads),
+           secs, 2.0 * b->ops * nb_threads / secs / 1e6);
+    if (b->use_mq)
+        heap_mq_destroy(&b->mq);
+    binary_tree_delete(b->heap);
+    free(threads);
+}
+
+/**
+ * main - Entry point
+ * @argc: Number of arguments
+ * @argv: Optional ops per thread and maximum thread count
+ *
+ * Return: 0 on success
+ */
+int main(int argc, char **argv)
+{
+    bench_t b;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads, t;
+
+    b.ops = argc > 1 ? strtoul(argv[1], NULL, 10) : 200000;
+    max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) :
+                  (size_t)(cpus > 0 ? cpus : 1);
+    pthread_mutex_init(&b.lock, NULL);
+
+    printf("impl,threads,ops,seconds,mops_per_sec\n");
+    for (t = 1; t <= max_threads; t *= 2)
+    {
+        b.use_mq = 0;
+        run(&b, t);
+        b.use_mq = 1;
+        run(&b, t);
+    }
+    pthread_mutex_destroy(&b.lock);
+
+    return (0);
+}
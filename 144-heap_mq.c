@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees_concurrent.h"
+
+/**
+ * heap_mq_init - Initialises an empty concurrent priority queue
+ * @mq: Pointer to the queue to initialise
+ * @nb_queues: Number of sub-queues, about twice the number of threads
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int heap_mq_init(heap_mq_t *mq, size_t nb_queues)
+{
+    size_t i;
+
+    if (mq == NULL || nb_queues == 0)
+        return (-1);
+
+    if (posix_memalign((void **)&mq->queues, BT_CACHE_LINE,
+                       nb_queues * sizeof(*mq->queues)) != 0)
+        return (-1);
+    memset(mq->queues, 0, nb_queues * sizeof(*mq->queues));
+    mq->nb_queues = nb_queues;
+    for (i = 0; i < nb_queues; i++)
+        pthread_mutex_init(&mq->queues[i].lock, NULL);
+
+    return (0);
+}
+
+/**
+ * heap_mq_destroy - Frees a concurrent priority queue
+ * @mq: Pointer to the queue, no thread may be using it any more
+ */
+void heap_mq_destroy(heap_mq_t *mq)
+{
+    size_t i;
+
+    if (mq == NULL || mq->queues == NULL)
+        return;
+
+    for (i = 0; i < mq->nb_queues; i++)
+    {
+        pthread_mutex_destroy(&mq->queues[i].lock);
+        free(mq->queues[i].array);
+    }
+    free(mq->queues);
+    mq->queues = NULL;
+    mq->nb_queues = 0;
+}
+
+/**
+ * heap_mq_push - Inserts a value in a locked sub-queue
+ * @queue: Pointer to the sub-queue, the caller holds its lock
+ * @value: The value to insert
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int heap_mq_push(heap_mq_queue_t *queue, int value)
+{
+    size_t i, parent;
+    int *array;
+
+    if (queue->size == queue->capacity)
+    {
+        array = realloc(queue->array, (queue->capacity ? queue->capacity * 2
+                                       : 64) * sizeof(int));
+        if (array == NULL)
+            return (-1);
+        queue->array = array;
+        queue->capacity = queue->capacity ? queue->capacity * 2 : 64;
+    }
+
+    for (i = queue->size; i > 0; i = parent)
+    {
+        parent = (i - 1) / 2;
+        if (!HEAP_HIGHER(value, queue->array[parent]))
+            break;
+        queue->array[i] = queue->array[parent];
+    }
+    queue->array[i] = value;
+    __atomic_store_n(&queue->top, queue->array[0], __ATOMIC_RELAXED);
+    __atomic_store_n(&queue->size, queue->size + 1, __ATOMIC_RELEASE);
+
+    return (0);
+}
+
+/**
+ * heap_mq_pop - Extracts the top value of a locked, non-empty sub-queue
+ * @queue: Pointer to the sub-queue, the caller holds its lock
+ *
+ * Return: The extracted value
+ */
+int heap_mq_pop(heap_mq_queue_t *queue)
+{
+    size_t i, child, size = queue->size - 1;
+    int value = queue->array[0], last = queue->array[size];
+
+    for (i = 0; (child = 2 * i + 1) < size; i = child)
+    {
+        if (child + 1 < size && HEAP_HIGHER(queue->array[child + 1],
+                                            queue->array[child]))
+            child++;
+        if (!HEAP_HIGHER(queue->array[child], last))
+            break;
+        queue->array[i] = queue->array[child];
+    }
+    queue->array[i] = last;
+    if (size > 0)
+        __atomic_store_n(&queue->top, queue->array[0], __ATOMIC_RELAXED);
+    __atomic_store_n(&queue->size, size, __ATOMIC_RELEASE);
+
+    return (value);
+}
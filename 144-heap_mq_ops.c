@@ -0,0 +1,119 @@
+#include <stdint.h>
+#include "binary_trees_concurrent.h"
+
+static __thread unsigned int mq_seed;
+
+/**
+ * mq_random - Picks a sub-queue index with a per-thread xorshift generator
+ * @mq: Pointer to the queue
+ *
+ * Return: Index below mq->nb_queues
+ */
+static size_t mq_random(const heap_mq_t *mq)
+{
+    unsigned int x = mq_seed;
+
+    if (x == 0)
+        x = (unsigned int)(uintptr_t)&mq_seed | 1;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    mq_seed = x;
+
+    return (x % mq->nb_queues);
+}
+
+/**
+ * heap_mq_insert - Inserts a value in a concurrent priority queue
+ * @mq: Pointer to the queue
+ * @value: The value to insert
+ *
+ * Description: tries random sub-queues until one is not locked, so a
+ * producer only waits when every sub-queue it draws is busy.
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int heap_mq_insert(heap_mq_t *mq, int value)
+{
+    heap_mq_queue_t *queue;
+    int ret;
+
+    do {
+        queue = &mq->queues[mq_random(mq)];
+    } while (pthread_mutex_trylock(&queue->lock) != 0);
+
+    ret = heap_mq_push(queue, value);
+    pthread_mutex_unlock(&queue->lock);
+
+    return (ret);
+}
+
+/**
+ * mq_pick - Chooses the better of two random sub-queues by their tops
+ * @mq: Pointer to the queue
+ *
+ * Return: Pointer to the chosen sub-queue, possibly empty
+ */
+static heap_mq_queue_t *mq_pick(const heap_mq_t *mq)
+{
+    heap_mq_queue_t *a = &mq->queues[mq_random(mq)];
+    heap_mq_queue_t *b = &mq->queues[mq_random(mq)];
+
+    if (__atomic_load_n(&a->size, __ATOMIC_ACQUIRE) == 0)
+        return (b);
+    if (__atomic_load_n(&b->size, __ATOMIC_ACQUIRE) == 0)
+        return (a);
+    if (HEAP_HIGHER(__atomic_load_n(&b->top, __ATOMIC_RELAXED),
+                    __atomic_load_n(&a->top, __ATOMIC_RELAXED)))
+        return (b);
+
+    return (a);
+}
+
+/**
+ * heap_mq_extract - Extracts a large value from a concurrent priority queue
+ * @mq: Pointer to the queue
+ * @value: Where to store the extracted value
+ *
+ * Description: after a few misses on empty sub-queues every sub-queue is
+ * scanned, so 0 is only returned when all of them were seen empty.
+ *
+ * Return: 1 if a value was extracted, 0 if the queue is empty
+ */
+int heap_mq_extract(heap_mq_t *mq, int *value)
+{
+    heap_mq_queue_t *queue;
+    size_t i, tries;
+
+    for (tries = 0; tries < 4; tries++)
+    {
+        queue = mq_pick(mq);
+        if (__atomic_load_n(&queue->size, __ATOMIC_ACQUIRE) == 0 ||
+            pthread_mutex_trylock(&queue->lock) != 0)
+            continue;
+        if (queue->size > 0)
+        {
+            *value = heap_mq_pop(queue);
+            pthread_mutex_unlock(&queue->lock);
+            return (1);
+        }
+        pthread_mutex_unlock(&queue->lock);
+    }
+
+    for (i = 0; i < mq->nb_queues; i++)
+    {
+        queue = &mq->queues[i];
+        if (__atomic_load_n(&queue->size, __ATOMIC_ACQUIRE) == 0)
+            continue;
+        pthread_mutex_lock(&queue->lock);
+        if (queue->size > 0)
+        {
+            *value = heap_mq_pop(queue);
+            pthread_mutex_unlock(&queue->lock);
+            return (1);
+        }
+        pthread_mutex_unlock(&queue->lock);
+    }
+
+    return (0);
+}
@@ -0,0 +1,137 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include "binary_trees.h"
+
+/*
+ * Per-thread node caches, enabled with -DBT_NODE_CACHE.
+ *
+ * Each thread keeps a free list chained through ->left. Nodes move between
+ * threads and the shared pool in batches of BT_CACHE_BATCH: a batch is a
+ * free list whose head stores its length in ->n, and the pool chains batch
+ * heads through ->right. Nodes carry no owner, so a node allocated on one
+ * thread may be freed on any other. Memory is carved from slabs of
+ * BT_CACHE_BATCH nodes and is kept for reuse rather than returned to malloc.
+ */
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static binary_tree_t *pool;
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t cache_key;
+
+static __thread binary_tree_t *cache;
+static __thread size_t cache_count;
+static __thread int cache_registered;
+
+/**
+ * cache_push_batch - Moves a batch from the calling thread to the pool
+ * @count: Number of nodes to move, at most cache_count
+ */
+static void cache_push_batch(size_t count)
+{
+    binary_tree_t *head = cache, *tail = cache;
+    size_t i;
+
+    for (i = 1; i < count; i++)
+        tail = tail->left;
+    cache = tail->left;
+    cache_count -= count;
+    tail->left = NULL;
+    head->n = (int)count;
+
+    pthread_mutex_lock(&pool_lock);
+    head->right = pool;
+    pool = head;
+    pthread_mutex_unlock(&pool_lock);
+}
+
+/**
+ * cache_flush - Thread exit destructor, hands the whole cache to the pool
+ * @arg: Unused
+ */
+static void cache_flush(void *arg)
+{
+    (void)arg;
+    if (cache_count > 0)
+        cache_push_batch(cache_count);
+}
+
+/**
+ * cache_init - Creates the key whose destructor flushes exiting threads
+ */
+static void cache_init(void)
+{
+    pthread_key_create(&cache_key, cache_flush);
+}
+
+/**
+ * cache_register - Arms the exit flush of the calling thread, once
+ *
+ * Description: called on both the alloc and free paths, so a thread that
+ * only frees nodes still hands its cache back when it exits.
+ */
+static void cache_register(void)
+{
+    if (cache_registered)
+        return;
+    pthread_once(&cache_once, cache_init);
+    pthread_setspecific(cache_key, &cache);
+    cache_registered = 1;
+}
+
+/**
+ * binary_tree_cache_alloc - Takes a node from the calling thread's cache
+ *
+ * Description: refills an empty cache with one batch from the pool, or
+ * with a fresh slab when the pool is empty.
+ *
+ * Return: Pointer to an uninitialised node, or NULL on failure
+ */
+binary_tree_t *binary_tree_cache_alloc(void)
+{
+    binary_tree_t *node;
+    size_t i;
+
+    if (cache == NULL)
+    {
+        cache_register();
+        pthread_mutex_lock(&pool_lock);
+        node = pool;
+        if (node != NULL)
+            pool = node->right;
+        pthread_mutex_unlock(&pool_lock);
+        if (node != NULL)
+        {
+            cache_count = (size_t)node->n;
+        }
+        else
+        {
+            node = malloc(BT_CACHE_BATCH * sizeof(*node));
+            if (node == NULL)
+                return (NULL);
+            for (i = 0; i + 1 < BT_CACHE_BATCH; i++)
+                node[i].left = &node[i + 1];
+            node[i].left = NULL;
+            cache_count = BT_CACHE_BATCH;
+        }
+        cache = node;
+    }
+
+    node = cache;
+    cache = node->left;
+    cache_count--;
+
+    return (node);
+}
+
+/**
+ * binary_tree_cache_free - Gives a node back to the calling thread's cache
+ * @node: Pointer to the node, allocated by any thread
+ */
+void binary_tree_cache_free(binary_tree_t *node)
+{
+    cache_register();
+    node->left = cache;
+    cache = node;
+    if (++cache_count >= 2 * BT_CACHE_BATCH)
+        cache_push_batch(BT_CACHE_BATCH);
+}
@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "binary_trees.h"
+
+#define NB_THREADS 4
+#define NB_KEYS 20000
+
+static bst_t *trees[NB_THREADS];
+
+/**
+ * builder - Builds a BST of random keys
+ * @arg: Index of the tree to build, cast to a pointer
+ *
+ * Return: Always NULL
+ */
+static void *builder(void *arg)
+{
+    size_t id = (size_t)arg, i;
+    unsigned int seed = (unsigned int)id + 1;
+
+    for (i = 0; i < NB_KEYS; i++)
+        bst_insert(&trees[id], rand_r(&seed));
+
+    return (NULL);
+}
+
+/**
+ * destroyer - Frees a tree built by another thread, remove by remove
+ * @arg: Index of the tree to free, cast to a pointer
+ *
+ * Return: Always NULL
+ */
+static void *destroyer(void *arg)
+{
+    size_t id = (size_t)arg;
+
+    while (trees[id] != NULL)
+        trees[id] = bst_remove(trees[id], trees[id]->n);
+
+    return (NULL);
+}
+
+/**
+ * main - Entry point, build with -DBT_NODE_CACHE -pthread
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    pthread_t threads[NB_THREADS];
+    size_t i, total = 0;
+
+    for (i = 0; i < NB_THREADS; i++)
+        pthread_create(&threads[i], NULL, builder, (void *)i);
+    for (i = 0; i < NB_THREADS; i++)
+        pthread_join(threads[i], NULL);
+    for (i = 0; i < NB_THREADS; i++)
+        total += binary_tree_size(trees[i]);
+    printf("Built %lu nodes on %d threads\n", (unsigned long)total,
+           NB_THREADS);
+
+    for (i = 0; i < NB_THREADS; i++)
+        pthread_create(&threads[i], NULL, destroyer,
+                       (void *)((i + 1) % NB_THREADS));
+    for (i = 0; i < NB_THREADS; i++)
+        pthread_join(threads[i], NULL);
+    printf("Freed every tree from a different thread\n");
+
+    for (i = 0; i < NB_THREADS; i++)
+        pthread_create(&threads[i], NULL, builder, (void *)i);
+    for (i = 0; i < NB_THREADS; i++)
+        pthread_join(threads[i], NULL);
+    for (i = 0; i < NB_THREADS; i++)
+        binary_tree_delete(trees[i]);
+    printf("Rebuilt and deleted\n");
+    return (0);
+}
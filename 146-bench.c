@@ -0,0 +1,323 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "binary_trees.h"
+
+/*
+ * Benchmark suite for the tree and heap operations.
+ *
+ * gcc -O2 146-bench.c 0-binary_tree_node.c 3-binary_tree_delete.c \
+ *     6-binary_tree_preorder.c 7-binary_tree_inorder.c \
+ *     8-binary_tree_postorder.c 11-binary_tree_size.c \
+ *     15-binary_tree_is_full.c 110-binary_tree_is_bst.c 111-bst_insert.c \
+ *     113-bst_search.c 114-bst_remove.c 120-binary_tree_is_avl.c \
+ *     121-avl_insert.c 103-binary_tree_rotate_left.c \
+ *     104-binary_tree_rotate_right.c 131-heap_insert.c 133-heap_extract.c \
+ *     134-heap_to_sorted_array.c 152-btree_search.c 152-btree_insert.c \
+ *     152-btree_remove.c -Wl,--wrap=malloc,--wrap=free \
+ *     -Wl,--wrap=posix_memalign -lm -o 146-bench
+ * ./146-bench [max_size] [min_size] > bench.csv
+ *
+ * Sizes go from min_size (default 1000) up to max_size (default 1000000)
+ * by powers of ten, 100000000 is accepted given enough memory. Every size
+ * runs the sorted, reverse, random, zipf and dups key distributions.
+ * Output is CSV: ns per operation, malloc/free calls made by the measured
+ * step, and the process peak RSS so far.
+ *
+ * binary_tree_is_complete and binary_tree_is_perfect are not measured:
+ * 102- and 16- each carry a private copy of binary_tree_height (and 102-
+ * of binary_tree_size), which clash with the copies in 120- and 11- at link
+ * time. Forcing the link with --allow-multiple-definition is not an
+ * option, since at -O2 GCC compiles each file assuming its own copy is the
+ * one called, and the mixed binary crashes.
+ *
+ * Plain BSTs built from sorted or reverse keys degrade into lists
+ * with O(n) recursion depth, rows whose tree would be deeper than
+ * BENCH_MAX_DEPTH are reported as skipped rather than overflowing the stack.
+ */
+
+#define BENCH_MAX_DEPTH 20000
+
+static size_t nb_allocs, nb_frees;
+static volatile long sink;
+
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+int __real_posix_memalign(void **ptr, size_t alignment, size_t size);
+
+/**
+ * __wrap_malloc - Counts allocations, linked with -Wl,--wrap=malloc
+ * @size: Number of bytes
+ *
+ * Return: Pointer returned by the real malloc
+ */
+void *__wrap_malloc(size_t size)
+{
+    nb_allocs++;
+    return (__real_malloc(size));
+}
+
+/**
+ * __wrap_posix_memalign - Counts aligned allocations, such as B+ tree
+ *                         nodes, linked with -Wl,--wrap=posix_memalign
+ * @ptr: Where to store the allocation
+ * @alignment: Required alignment
+ * @size: Number of bytes
+ *
+ * Return: Value returned by the real posix_memalign
+ */
+int __wrap_posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+    nb_allocs++;
+    return (__real_posix_memalign(ptr, alignment, size));
+}
+
+/**
+ * __wrap_free - Counts releases, linked with -Wl,--wrap=free
+ * @ptr: Pointer to release
+ */
+void __wrap_free(void *ptr)
+{
+    if (ptr != NULL)
+        nb_frees++;
+    __real_free(ptr);
+}
+
+/**
+ * visit - Traversal callback that keeps the traversal from being elided
+ * @n: Value of the visited node
+ */
+static void visit(int n)
+{
+    sink += n;
+}
+
+/**
+ * make_keys - Generates the keys of one distribution
+ * @dist: Name of the distribution
+ * @size: Number of keys
+ *
+ * Return: Newly allocated array of keys, or NULL on failure
+ */
+static int *make_keys(const char *dist, size_t size)
+{
+    int *keys = malloc(size * sizeof(int));
+    unsigned long x = 88172645463325252UL;
+    size_t i, k;
+
+    if (keys == NULL)
+        return (NULL);
+    for (i = 0; i < size; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        if (strcmp(dist, "sorted") == 0)
+            keys[i] = (int)i;
+        else if (strcmp(dist, "reverse") == 0)
+            keys[i] = (int)(size - i);
+        else if (strcmp(dist, "dups") == 0)
+            keys[i] = (int)(x % (size / 16 + 1));
+        else if (strcmp(dist, "zipf") == 0)
+        {
+            /* s = 1: P(rank <= k) ~ log(k) / log(size), then scatter ranks */
+            k = (size_t)exp((double)(x >> 11) / 9007199254740992.0 *
+                            log((double)size + 1.0));
+            keys[i] = (int)((k * 2654435761UL) % (size * 4));
+        }
+        else
+            keys[i] = (int)(x & 0x7fffffff);
+    }
+
+    return (keys);
+}
+
+/**
+ * report - Prints one CSV row
+ * @op: Name of the measured operation
+ * @dist: Name of the key distribution
+ * @size: Number of keys
+ * @t0: Time the step started
+ * @ops: Number of operations in the step, 0 if it was skipped
+ */
+static void report(const char *op, const char *dist, size_t size,
+                   const struct timespec *t0, size_t ops)
+{
+    struct timespec t1;
+    struct rusage usage;
+    double ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    getrusage(RUSAGE_SELF, &usage);
+    ns = (t1.tv_sec - t0->tv_sec) * 1e9 + (t1.tv_nsec - t0->tv_nsec);
+    if (ops == 0)
+        printf("%s,%s,%lu,skipped,,,%ld\n", op, dist, (unsigned long)size,
+               usage.ru_maxrss);
+    else
+        printf("%s,%s,%lu,%.1f,%lu,%lu,%ld\n", op, dist, (unsigned long)size,
+               ns / (double)ops, (unsigned long)nb_allocs,
+               (unsigned long)nb_frees, usage.ru_maxrss);
+    fflush(stdout);
+}
+
+/* Starts a measured step */
+#define STEP(t0) (nb_allocs = 0, nb_frees = 0, \
+                  clock_gettime(CLOCK_MONOTONIC, &(t0)))
+
+/**
+ * bench_trees - Measures BST and AVL operations on one key set
+ * @dist: Name of the key distribution
+ * @keys: Keys to insert
+ * @size: Number of keys
+ */
+static void bench_trees(const char *dist, const int *keys, size_t size)
+{
+    struct timespec t0;
+    bst_t *tree = NULL;
+    avl_t *avl = NULL;
+    size_t i, ok = size;
+
+    if (size > BENCH_MAX_DEPTH && (strcmp(dist, "sorted") == 0 ||
+                                   strcmp(dist, "reverse") == 0))
+        ok = 0;
+
+    STEP(t0);
+    for (i = 0; ok && i < size; i++)
+        bst_insert(&tree, keys[i]);
+    report("bst_insert", dist, size, &t0, ok);
+    STEP(t0);
+    for (i = 0; ok && i < size; i++)
+        sink += bst_search(tree, keys[i]) != NULL;
+    report("bst_search", dist, size, &t0, ok);
+    STEP(t0);
+    binary_tree_preorder(tree, visit);
+    report("binary_tree_preorder", dist, size, &t0, ok);
+    STEP(t0);
+    binary_tree_inorder(tree, visit);
+    report("binary_tree_inorder", dist, size, &t0, ok);
+    STEP(t0);
+    binary_tree_postorder(tree, visit);
+    report("binary_tree_postorder", dist, size, &t0, ok);
+    STEP(t0);
+    sink += binary_tree_size(tree);
+    report("binary_tree_size", dist, size, &t0, ok);
+    STEP(t0);
+    sink += binary_tree_is_bst(tree);
+    report("binary_tree_is_bst", dist, size, &t0, ok);
+    STEP(t0);
+    sink += binary_tree_is_full(tree);
+    report("binary_tree_is_full", dist, size, &t0, ok);
+    STEP(t0);
+    sink += binary_tree_is_avl(tree);
+    report("binary_tree_is_avl", dist, size, &t0, ok);
+    STEP(t0);
+    for (i = 0; ok && i < size; i++)
+        tree = bst_remove(tree, keys[i]);
+    report("bst_remove", dist, size, &t0, ok);
+    binary_tree_delete(tree);
+
+    STEP(t0);
+    for (i = 0; i < size; i++)
+        avl_insert(&avl, keys[i]);
+    report("avl_insert", dist, size, &t0, size);
+    STEP(t0);
+    binary_tree_delete(avl);
+    report("binary_tree_delete", dist, size, &t0, size);
+}
+
+/**
+ * bench_btree - Measures B+ tree operations on one key set
+ * @dist: Name of the key distribution
+ * @keys: Keys to insert
+ * @size: Number of keys
+ */
+static void bench_btree(const char *dist, const int *keys, size_t size)
+{
+    struct timespec t0;
+    btree_t tree = {NULL, 0};
+    size_t i;
+
+    STEP(t0);
+    for (i = 0; i < size; i++)
+        btree_insert(&tree, keys[i]);
+    report("btree_insert", dist, size, &t0, size);
+    STEP(t0);
+    for (i = 0; i < size; i++)
+        sink += btree_search(&tree, keys[i]);
+    report("btree_search", dist, size, &t0, size);
+    STEP(t0);
+    sink += btree_range(&tree, 0, 0x7fffffff, visit);
+    report("btree_range", dist, size, &t0, size);
+    STEP(t0);
+    for (i = 0; i < size; i++)
+        btree_remove(&tree, keys[i]);
+    report("btree_remove", dist, size, &t0, size);
+    btree_delete(&tree);
+}
+
+/**
+ * bench_heap - Measures heap operations on one key set
+ * @dist: Name of the key distribution
+ * @keys: Keys to insert
+ * @size: Number of keys
+ */
+static void bench_heap(const char *dist, const int *keys, size_t size)
+{
+    struct timespec t0;
+    heap_t *heap = NULL;
+    size_t i, sorted_size;
+    int *sorted;
+
+    STEP(t0);
+    for (i = 0; i < size; i++)
+        heap_insert(&heap, keys[i]);
+    report("heap_insert", dist, size, &t0, size);
+    STEP(t0);
+    for (i = 0; i < size; i++)
+        sink += heap_extract(&heap);
+    report("heap_extract", dist, size, &t0, size);
+
+    for (i = 0; i < size; i++)
+        heap_insert(&heap, keys[i]);
+    STEP(t0);
+    sorted = heap_to_sorted_array(heap, &sorted_size);
+    report("heap_to_sorted_array", dist, size, &t0, size);
+    free(sorted);
+}
+
+/**
+ * main - Entry point
+ * @argc: Number of arguments
+ * @argv: Optional maximum and minimum sizes
+ *
+ * Return: 0 on success, 1 on allocation failure
+ */
+int main(int argc, char **argv)
+{
+    const char *dists[] = {"sorted", "reverse", "random", "zipf", "dups"};
+    size_t max_size, size, d;
+    int *keys;
+
+    max_size = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    size = argc > 2 ? strtoul(argv[2], NULL, 10) : 1000;
+
+    printf("op,dist,size,ns_per_op,allocs,frees,peak_rss_kb\n");
+    for (; size <= max_size; size *= 10)
+    {
+        for (d = 0; d < sizeof(dists) / sizeof(dists[0]); d++)
+        {
+            keys = make_keys(dists[d], size);
+            if (keys == NULL)
+                return (1);
+            bench_trees(dists[d], keys, size);
+            bench_btree(dists[d], keys, size);
+            bench_heap(dists[d], keys, size);
+            free(keys);
+        }
+    }
+
+    return (0);
+}
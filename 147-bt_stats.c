@@ -0,0 +1,32 @@
+#include <string.h>
+#include "binary_trees.h"
+
+#ifdef BT_STATS
+__thread bt_stats_t bt_stats;
+#endif
+
+/**
+ * bt_stats_snapshot - Copies the operation counters of the calling thread
+ * @stats: Where to store the counters, all zero unless built with BT_STATS
+ */
+void bt_stats_snapshot(bt_stats_t *stats)
+{
+    if (stats == NULL)
+        return;
+
+#ifdef BT_STATS
+    *stats = bt_stats;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+/**
+ * bt_stats_reset - Clears the operation counters of the calling thread
+ */
+void bt_stats_reset(void)
+{
+#ifdef BT_STATS
+    memset(&bt_stats, 0, sizeof(bt_stats));
+#endif
+}
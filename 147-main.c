@@ -0,0 +1,58 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_stats - Prints the counters gathered since the last reset
+ * @label: Name of the measured step
+ */
+static void print_stats(const char *label)
+{
+    bt_stats_t stats;
+
+    bt_stats_snapshot(&stats);
+    printf("%s: comparisons=%lu visits=%lu rotations=%lu allocs=%lu "
+           "frees=%lu max_depth=%lu\n", label, stats.comparisons,
+           stats.visits, stats.rotations, stats.allocs, stats.frees,
+           (unsigned long)stats.max_depth);
+    bt_stats_reset();
+}
+
+/**
+ * main - Entry point, build with -DBT_STATS to enable the counters
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    heap_t *heap;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    print_stats("array_to_bst");
+
+    bst_search(tree, 62);
+    print_stats("bst_search 62");
+
+    tree = bst_remove(tree, 79);
+    print_stats("bst_remove 79");
+
+    tree = binary_tree_rotate_right(tree);
+    print_stats("rotate_right");
+    binary_tree_delete(tree);
+    print_stats("binary_tree_delete");
+
+    heap = array_to_heap(array, n);
+    print_stats("array_to_heap");
+    heap_extract(&heap);
+    print_stats("heap_extract");
+    binary_tree_delete(heap);
+    return (0);
+}
@@ -0,0 +1,65 @@
+#include "binary_trees.h"
+
+/**
+ * bt_timed_bst_insert - Times a call to bst_insert
+ * @tree: Double pointer to the root node of the BST
+ * @value: Value to insert
+ *
+ * Return: Same as bst_insert
+ */
+bst_t *bt_timed_bst_insert(bst_t **tree, int value)
+{
+    unsigned long start = bt_cycles();
+    bst_t *node = bst_insert(tree, value);
+
+    bt_timing_record(BT_OP_BST_INSERT, bt_cycles() - start);
+    return (node);
+}
+
+/**
+ * bt_timed_bst_search - Times a call to bst_search
+ * @tree: Pointer to the root node of the BST
+ * @value: Value to search
+ *
+ * Return: Same as bst_search
+ */
+bst_t *bt_timed_bst_search(const bst_t *tree, int value)
+{
+    unsigned long start = bt_cycles();
+    bst_t *node = bst_search(tree, value);
+
+    bt_timing_record(BT_OP_BST_SEARCH, bt_cycles() - start);
+    return (node);
+}
+
+/**
+ * bt_timed_bst_remove - Times a call to bst_remove
+ * @root: Pointer to the root node of the BST
+ * @value: Value to remove
+ *
+ * Return: Same as bst_remove
+ */
+bst_t *bt_timed_bst_remove(bst_t *root, int value)
+{
+    unsigned long start = bt_cycles();
+
+    root = bst_remove(root, value);
+    bt_timing_record(BT_OP_BST_REMOVE, bt_cycles() - start);
+    return (root);
+}
+
+/**
+ * bt_timed_avl_insert - Times a call to avl_insert
+ * @tree: Double pointer to the root node of the AVL tree
+ * @value: Value to insert
+ *
+ * Return: Same as avl_insert
+ */
+binary_tree_t *bt_timed_avl_insert(binary_tree_t **tree, int value)
+{
+    unsigned long start = bt_cycles();
+    binary_tree_t *node = avl_insert(tree, value);
+
+    bt_timing_record(BT_OP_AVL_INSERT, bt_cycles() - start);
+    return (node);
+}
@@ -0,0 +1,32 @@
+#include "binary_trees.h"
+
+/**
+ * bt_timed_heap_insert - Times a call to heap_insert
+ * @root: Double pointer to the root node of the heap
+ * @value: Value to insert
+ *
+ * Return: Same as heap_insert
+ */
+heap_t *bt_timed_heap_insert(heap_t **root, int value)
+{
+    unsigned long start = bt_cycles();
+    heap_t *node = heap_insert(root, value);
+
+    bt_timing_record(BT_OP_HEAP_INSERT, bt_cycles() - start);
+    return (node);
+}
+
+/**
+ * bt_timed_heap_extract - Times a call to heap_extract
+ * @root: Double pointer to the root node of the heap
+ *
+ * Return: Same as heap_extract
+ */
+int bt_timed_heap_extract(heap_t **root)
+{
+    unsigned long start = bt_cycles();
+    int value = heap_extract(root);
+
+    bt_timing_record(BT_OP_HEAP_EXTRACT, bt_cycles() - start);
+    return (value);
+}
@@ -0,0 +1,138 @@
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "binary_trees.h"
+
+/*
+ * Latency histograms shared by every thread. Buckets are updated with
+ * relaxed atomic adds, so recording never takes a lock.
+ */
+static unsigned long histogram[BT_OP_COUNT][BT_TIMING_BUCKETS];
+static unsigned long hook_threshold;
+static bt_trace_hook_t hook_func;
+static void *hook_ctx;
+
+/**
+ * bt_cycles - Reads a cheap monotonic cycle counter
+ *
+ * Return: Time stamp counter on x86, virtual counter on AArch64,
+ * nanoseconds elsewhere
+ */
+unsigned long bt_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return ((unsigned long)__rdtsc());
+#elif defined(__aarch64__)
+    unsigned long ticks;
+
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (ticks));
+    return (ticks);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((unsigned long)ts.tv_sec * 1000000000UL + ts.tv_nsec);
+#endif
+}
+
+/**
+ * bt_timing_record - Adds one duration to the histogram of an operation
+ * @op: Timed operation
+ * @cycles: Duration in cycles
+ *
+ * Description: values below 4 get a bucket each, larger ones land in one
+ * of four buckets per power of two, which bounds the error to 25%.
+ */
+void bt_timing_record(bt_op_t op, unsigned long cycles)
+{
+    unsigned int bucket, log2;
+
+    if (cycles < 4)
+    {
+        bucket = (unsigned int)cycles;
+    }
+    else
+    {
+        log2 = 8 * sizeof(long) - 1 - __builtin_clzl(cycles);
+        bucket = 4 * (log2 - 1) + ((cycles >> (log2 - 2)) & 3);
+    }
+    __atomic_fetch_add(&histogram[op][bucket], 1, __ATOMIC_RELAXED);
+
+    if (hook_func != NULL && cycles >= hook_threshold)
+        hook_func(op, cycles, hook_ctx);
+}
+
+/**
+ * bt_timing_set_hook - Registers a function called on slow operations
+ * @threshold: Minimum duration in cycles that triggers the hook
+ * @hook: Function to call, NULL to remove the hook
+ * @ctx: Opaque pointer passed back to the hook
+ *
+ * Description: set the hook before starting the threads it observes.
+ */
+void bt_timing_set_hook(unsigned long threshold, bt_trace_hook_t hook,
+                        void *ctx)
+{
+    hook_threshold = threshold;
+    hook_ctx = ctx;
+    hook_func = hook;
+}
+
+/**
+ * bt_timing_reset - Clears every latency histogram
+ */
+void bt_timing_reset(void)
+{
+    memset(histogram, 0, sizeof(histogram));
+}
+
+/**
+ * bt_timing_count - Counts the recorded durations of an operation
+ * @op: Timed operation
+ *
+ * Return: Number of recorded calls
+ */
+unsigned long bt_timing_count(bt_op_t op)
+{
+    unsigned long count = 0;
+    unsigned int i;
+
+    for (i = 0; i < BT_TIMING_BUCKETS; i++)
+        count += __atomic_load_n(&histogram[op][i], __ATOMIC_RELAXED);
+
+    return (count);
+}
+
+/**
+ * bt_timing_percentile - Estimates a latency percentile of an operation
+ * @op: Timed operation
+ * @percent: Percentile to estimate, e.g. 50, 99 or 99.9
+ *
+ * Return: Upper bound in cycles of the bucket holding the percentile,
+ * or 0 if nothing was recorded
+ */
+unsigned long bt_timing_percentile(bt_op_t op, double percent)
+{
+    unsigned long total = bt_timing_count(op), seen = 0, rank;
+    unsigned int i, log2;
+
+    if (total == 0)
+        return (0);
+
+    rank = (unsigned long)(percent / 100.0 * (double)total);
+    if (rank >= total)
+        rank = total - 1;
+    for (i = 0; i < BT_TIMING_BUCKETS; i++)
+    {
+        seen += __atomic_load_n(&histogram[op][i], __ATOMIC_RELAXED);
+        if (seen > rank)
+            break;
+    }
+    if (i < 4)
+        return (i);
+
+    log2 = i / 4 + 1;
+    return ((((unsigned long)(4 | (i & 3)) + 1) << (log2 - 2)) - 1);
+}
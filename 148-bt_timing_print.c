@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * bt_op_name - Gives the name of a timed operation
+ * @op: Timed operation
+ *
+ * Return: Name of the wrapped function
+ */
+const char *bt_op_name(bt_op_t op)
+{
+    static const char *const names[BT_OP_COUNT] = {
+        "bst_insert", "bst_search", "bst_remove", "avl_insert",
+        "heap_insert", "heap_extract"
+    };
+
+    if (op >= BT_OP_COUNT)
+        return ("unknown");
+
+    return (names[op]);
+}
+
+/**
+ * bt_timing_print - Prints the latency percentiles of every operation
+ *
+ * Description: one CSV row per operation that was called at least once,
+ * durations are in cycles.
+ */
+void bt_timing_print(void)
+{
+    unsigned int op;
+
+    printf("op,count,p50_cycles,p99_cycles,p999_cycles\n");
+    for (op = 0; op < BT_OP_COUNT; op++)
+    {
+        if (bt_timing_count((bt_op_t)op) == 0)
+            continue;
+        printf("%s,%lu,%lu,%lu,%lu\n", bt_op_name((bt_op_t)op),
+               bt_timing_count((bt_op_t)op),
+               bt_timing_percentile((bt_op_t)op, 50.0),
+               bt_timing_percentile((bt_op_t)op, 99.0),
+               bt_timing_percentile((bt_op_t)op, 99.9));
+    }
+}
@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 100000
+
+/**
+ * on_slow - Trace hook counting slow operations
+ * @op: Timed operation
+ * @cycles: Duration of the call
+ * @ctx: Pointer to the counter
+ */
+static void on_slow(bt_op_t op, unsigned long cycles, void *ctx)
+{
+    (void)op;
+    (void)cycles;
+    (*(unsigned long *)ctx)++;
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree = NULL;
+    heap_t *heap = NULL;
+    unsigned long slow = 0;
+    unsigned int seed = 1;
+    int i;
+
+    bt_timing_set_hook(100000, on_slow, &slow);
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        bt_timed_bst_insert(&tree, rand_r(&seed));
+        bt_timed_heap_insert(&heap, rand_r(&seed));
+    }
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        bt_timed_bst_search(tree, rand_r(&seed));
+        bt_timed_heap_extract(&heap);
+    }
+
+    bt_timing_print();
+    printf("Slow operations: %lu\n", slow);
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees_concurrent.h"
+
+#define NB_READERS 2
+#define NB_VERSIONS 20000
+
+static pbst_cell_t shared = {NULL, 0, {0, 0}};
+static int stop;
+
+/**
+ * print_value - Prints one value of a traversal
+ * @n: Value to print
+ */
+static void print_value(int n)
+{
+    printf(" %d", n);
+}
+
+/**
+ * reader - Takes snapshots in a loop until told to stop
+ * @arg: Unused
+ *
+ * Return: Number of snapshots missing the value 0, cast to a pointer
+ */
+static void *reader(void *arg)
+{
+    size_t misses = 0;
+    pbst_t *version;
+
+    (void)arg;
+    while (!__atomic_load_n(&stop, __ATOMIC_ACQUIRE))
+    {
+        version = pbst_snapshot(&shared);
+        if (pbst_search(version, 0) == NULL)
+            misses++;
+        pbst_release(version);
+    }
+
+    return ((void *)misses);
+}
+
+/**
+ * publish_under_load - Publishes versions while readers keep snapshotting
+ *
+ * Return: 0 if every snapshot was intact, 1 otherwise
+ */
+static int publish_under_load(void)
+{
+    pthread_t threads[NB_READERS];
+    pbst_t *version, *next;
+    size_t i, misses = 0;
+    void *ret;
+
+    if (pbst_insert(NULL, 0, &shared.root) == -1)
+        return (1);
+    for (i = 0; i < NB_READERS; i++)
+        pthread_create(&threads[i], NULL, reader, NULL);
+    for (i = 1; i <= NB_VERSIONS; i++)
+    {
+        version = pbst_snapshot(&shared);
+        if (pbst_insert(version, (int)i, &next) != -1)
+            pbst_publish(&shared, next);
+        pbst_release(version);
+    }
+    __atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+    for (i = 0; i < NB_READERS; i++)
+    {
+        pthread_join(threads[i], &ret);
+        misses += (size_t)ret;
+    }
+    printf("Published %d versions under load, broken snapshots: %lu\n",
+           NB_VERSIONS, (unsigned long)misses);
+    pbst_release(shared.root);
+
+    return (misses != 0);
+}
+
+/**
+ * main - Entry point, build with -pthread
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    pbst_cell_t cell = {NULL, 0, {0, 0}};
+    pbst_t *version, *next, *snapshot;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]), i;
+
+    for (i = 0; i < n; i++)
+    {
+        version = pbst_snapshot(&cell);
+        if (pbst_insert(version, array[i], &next) == -1)
+            return (1);
+        pbst_release(version);
+        pbst_publish(&cell, next);
+    }
+
+    snapshot = pbst_snapshot(&cell);
+    printf("Snapshot height: %d\n", snapshot->height);
+
+    version = pbst_snapshot(&cell);
+    pbst_remove(version, 79, &next);
+    pbst_release(version);
+    pbst_publish(&cell, next);
+    version = pbst_snapshot(&cell);
+    pbst_insert(version, 50, &next);
+    pbst_release(version);
+    pbst_publish(&cell, next);
+
+    printf("Snapshot:");
+    pbst_inorder(snapshot, print_value);
+    printf("\nCurrent: ");
+    version = pbst_snapshot(&cell);
+    pbst_inorder(version, print_value);
+    printf("\n");
+
+    pbst_release(version);
+    pbst_release(snapshot);
+    pbst_release(cell.root);
+    return (publish_under_load());
+}
@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+/**
+ * pbst_retain - Takes a reference to a persistent tree
+ * @tree: Pointer to the root node, may be NULL
+ *
+ * Return: tree, now referenced once more
+ */
+pbst_t *pbst_retain(pbst_t *tree)
+{
+    if (tree != NULL)
+        __atomic_add_fetch(&tree->refs, 1, __ATOMIC_RELAXED);
+
+    return (tree);
+}
+
+/**
+ * pbst_release - Drops a reference to a persistent tree
+ * @tree: Pointer to the root node, may be NULL
+ *
+ * Description: frees the nodes no other version references any more.
+ */
+void pbst_release(pbst_t *tree)
+{
+    if (tree == NULL || __atomic_sub_fetch(&tree->refs, 1,
+                                           __ATOMIC_ACQ_REL) != 0)
+        return;
+
+    pbst_release(tree->left);
+    pbst_release(tree->right);
+    free(tree);
+}
+
+/**
+ * pbst_search - Searches for a value in a persistent tree
+ * @tree: Pointer to the root node of the version to search
+ * @value: The value to search in the tree
+ *
+ * Return: A pointer to the node containing the value, or NULL if not found
+ */
+const pbst_t *pbst_search(const pbst_t *tree, int value)
+{
+    while (tree != NULL && tree->n != value)
+        tree = value < tree->n ? tree->left : tree->right;
+
+    return (tree);
+}
+
+/**
+ * pbst_inorder - Goes through a persistent tree using in-order traversal
+ * @tree: Pointer to the root node of the version to traverse
+ * @func: Pointer to a function to call for each value
+ */
+void pbst_inorder(const pbst_t *tree, void (*func)(int))
+{
+    if (tree == NULL || func == NULL)
+        return;
+
+    pbst_inorder(tree->left, func);
+    func(tree->n);
+    pbst_inorder(tree->right, func);
+}
@@ -0,0 +1,53 @@
+#include <sched.h>
+#include "binary_trees_concurrent.h"
+
+/**
+ * pbst_snapshot - Takes the current version of a shared persistent tree
+ * @cell: Pointer to the shared cell
+ *
+ * Description: lock-free and O(1), the snapshot never changes afterwards.
+ *
+ * Return: Current version, to be released with pbst_release
+ */
+pbst_t *pbst_snapshot(pbst_cell_t *cell)
+{
+    pbst_t *root;
+    unsigned long gen;
+
+    /* Count in a generation that no writer has started draining yet */
+    for (;;)
+    {
+        gen = __atomic_load_n(&cell->gen, __ATOMIC_SEQ_CST);
+        __atomic_add_fetch(&cell->readers[gen], 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&cell->gen, __ATOMIC_SEQ_CST) == gen)
+            break;
+        __atomic_sub_fetch(&cell->readers[gen], 1, __ATOMIC_RELEASE);
+    }
+    root = pbst_retain(__atomic_load_n(&cell->root, __ATOMIC_SEQ_CST));
+    __atomic_sub_fetch(&cell->readers[gen], 1, __ATOMIC_RELEASE);
+
+    return (root);
+}
+
+/**
+ * pbst_publish - Makes a new version current
+ * @cell: Pointer to the shared cell
+ * @root: New version, ownership moves to the cell
+ *
+ * Description: writers must be serialised by the caller. The previous
+ * version is released once no reader can be about to retain it: readers
+ * that counted in before the generation flip are waited for, later ones
+ * can only load the new version.
+ */
+void pbst_publish(pbst_cell_t *cell, pbst_t *root)
+{
+    pbst_t *old;
+    unsigned long gen;
+
+    old = __atomic_exchange_n(&cell->root, root, __ATOMIC_SEQ_CST);
+    gen = __atomic_load_n(&cell->gen, __ATOMIC_RELAXED);
+    __atomic_store_n(&cell->gen, gen ^ 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&cell->readers[gen], __ATOMIC_ACQUIRE) != 0)
+        sched_yield();
+    pbst_release(old);
+}
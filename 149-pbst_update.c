@@ -0,0 +1,219 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+/*
+ * Every helper below takes ownership of the subtrees passed to it and
+ * returns an owned subtree. *status becomes -1 on allocation failure, after
+ * which helpers release what they are given and return NULL, so a failed
+ * update unwinds without leaking and leaves the old version untouched.
+ */
+
+#define PBST_HEIGHT(t) ((t) != NULL ? (t)->height : 0)
+
+/**
+ * pbst_node - Builds a node over two owned subtrees
+ * @n: Value of the node
+ * @left: Owned left subtree
+ * @right: Owned right subtree
+ * @status: Set to -1 on failure
+ *
+ * Return: The new node, or NULL on failure
+ */
+static pbst_t *pbst_node(int n, pbst_t *left, pbst_t *right, int *status)
+{
+    pbst_t *node = NULL;
+
+    if (*status != -1)
+        node = malloc(sizeof(*node));
+    if (node == NULL)
+    {
+        *status = -1;
+        pbst_release(left);
+        pbst_release(right);
+        return (NULL);
+    }
+
+    node->n = n;
+    node->refs = 1;
+    node->left = left;
+    node->right = right;
+    node->height = 1 + (PBST_HEIGHT(left) > PBST_HEIGHT(right) ?
+                        PBST_HEIGHT(left) : PBST_HEIGHT(right));
+
+    return (node);
+}
+
+/**
+ * pbst_balance - Builds a node and restores the AVL property with copies
+ * @n: Value of the node
+ * @left: Owned left subtree
+ * @right: Owned right subtree
+ * @status: Set to -1 on failure
+ *
+ * Return: The new subtree root, or NULL on failure
+ */
+static pbst_t *pbst_balance(int n, pbst_t *left, pbst_t *right, int *status)
+{
+    pbst_t *res, *c;
+
+    if (*status != -1 && PBST_HEIGHT(left) > PBST_HEIGHT(right) + 1)
+    {
+        c = left->right;
+        if (PBST_HEIGHT(left->left) >= PBST_HEIGHT(c))
+            res = pbst_node(left->n, pbst_retain(left->left),
+                            pbst_node(n, pbst_retain(c), right, status),
+                            status);
+        else
+            res = pbst_node(c->n,
+                            pbst_node(left->n, pbst_retain(left->left),
+                                      pbst_retain(c->left), status),
+                            pbst_node(n, pbst_retain(c->right), right,
+                                      status), status);
+        pbst_release(left);
+        return (res);
+    }
+    if (*status != -1 && PBST_HEIGHT(right) > PBST_HEIGHT(left) + 1)
+    {
+        c = right->left;
+        if (PBST_HEIGHT(right->right) >= PBST_HEIGHT(c))
+            res = pbst_node(right->n,
+                            pbst_node(n, left, pbst_retain(c), status),
+                            pbst_retain(right->right), status);
+        else
+            res = pbst_node(c->n,
+                            pbst_node(n, left, pbst_retain(c->left), status),
+                            pbst_node(right->n, pbst_retain(c->right),
+                                      pbst_retain(right->right), status),
+                            status);
+        pbst_release(right);
+        return (res);
+    }
+
+    return (pbst_node(n, left, right, status));
+}
+
+/**
+ * pbst_ins - Recursive helper of pbst_insert
+ * @t: Borrowed subtree
+ * @value: Value to insert
+ * @status: Set to 1 if inserted, 0 if present, -1 on failure
+ *
+ * Return: Owned updated subtree
+ */
+static pbst_t *pbst_ins(pbst_t *t, int value, int *status)
+{
+    pbst_t *child;
+
+    if (t == NULL)
+    {
+        *status = 1;
+        return (pbst_node(value, NULL, NULL, status));
+    }
+    if (value == t->n)
+    {
+        *status = 0;
+        return (pbst_retain(t));
+    }
+
+    child = pbst_ins(value < t->n ? t->left : t->right, value, status);
+    if (*status != 1)
+    {
+        pbst_release(child);
+        return (*status == 0 ? pbst_retain(t) : NULL);
+    }
+    if (value < t->n)
+        return (pbst_balance(t->n, child, pbst_retain(t->right), status));
+
+    return (pbst_balance(t->n, pbst_retain(t->left), child, status));
+}
+
+/**
+ * pbst_rem - Recursive helper of pbst_remove
+ * @t: Borrowed subtree
+ * @value: Value to remove
+ * @status: Set to 1 if removed, 0 if absent, -1 on failure
+ *
+ * Return: Owned updated subtree
+ */
+static pbst_t *pbst_rem(pbst_t *t, int value, int *status)
+{
+    pbst_t *child, *succ;
+
+    if (t == NULL)
+    {
+        *status = 0;
+        return (NULL);
+    }
+    if (value == t->n)
+    {
+        *status = 1;
+        if (t->left == NULL || t->right == NULL)
+            return (pbst_retain(t->left != NULL ? t->left : t->right));
+        for (succ = t->right; succ->left != NULL; succ = succ->left)
+            ;
+        child = pbst_rem(t->right, succ->n, status);
+        return (pbst_balance(succ->n, pbst_retain(t->left), child, status));
+    }
+
+    child = pbst_rem(value < t->n ? t->left : t->right, value, status);
+    if (*status != 1)
+    {
+        pbst_release(child);
+        return (*status == 0 ? pbst_retain(t) : NULL);
+    }
+    if (value < t->n)
+        return (pbst_balance(t->n, child, pbst_retain(t->right), status));
+
+    return (pbst_balance(t->n, pbst_retain(t->left), child, status));
+}
+
+/**
+ * pbst_insert - Builds a new version of a persistent tree with a value
+ * @tree: Pointer to the root node of the version to update, may be NULL
+ * @value: Value to insert
+ * @out: Where to store the new version, owned by the caller
+ *
+ * Description: tree is left untouched and still owned by the caller.
+ * Only the O(log n) nodes along the search path are copied.
+ *
+ * Return: 1 if inserted, 0 if already present (*out is then tree, retained),
+ * -1 on failure
+ */
+int pbst_insert(pbst_t *tree, int value, pbst_t **out)
+{
+    int status = 0;
+    pbst_t *root;
+
+    if (out == NULL)
+        return (-1);
+
+    root = pbst_ins(tree, value, &status);
+    if (status != -1)
+        *out = root;
+
+    return (status);
+}
+
+/**
+ * pbst_remove - Builds a new version of a persistent tree without a value
+ * @tree: Pointer to the root node of the version to update, may be NULL
+ * @value: Value to remove
+ * @out: Where to store the new version, owned by the caller
+ *
+ * Return: 1 if removed, 0 if absent (*out is then tree, retained),
+ * -1 on failure
+ */
+int pbst_remove(pbst_t *tree, int value, pbst_t **out)
+{
+    int status = 0;
+    pbst_t *root;
+
+    if (out == NULL)
+        return (-1);
+
+    root = pbst_rem(tree, value, &status);
+    if (status != -1)
+        *out = root;
+
+    return (status);
+}
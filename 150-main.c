@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 100000
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree = NULL, *lo, *hi;
+    int i;
+
+    for (i = 0; i < NB_KEYS; i++)
+        treap_insert(&tree, i);
+    printf("Sorted insert of %d keys, height: %lu\n", NB_KEYS,
+           (unsigned long)binary_tree_height(tree));
+    printf("Is BST: %d\n", binary_tree_is_bst(tree));
+
+    for (i = 0; i < NB_KEYS; i += 2)
+        tree = treap_remove(tree, i);
+    printf("After removing even keys, size: %lu, height: %lu\n",
+           (unsigned long)binary_tree_size(tree),
+           (unsigned long)binary_tree_height(tree));
+
+    treap_split(tree, NB_KEYS / 2, &lo, &hi);
+    printf("Split at %d: %lu below, %lu above\n", NB_KEYS / 2,
+           (unsigned long)binary_tree_size(lo),
+           (unsigned long)binary_tree_size(hi));
+    tree = treap_merge(lo, hi);
+    printf("Merged, size: %lu, is BST: %d\n",
+           (unsigned long)binary_tree_size(tree), binary_tree_is_bst(tree));
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,165 @@
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include "binary_trees.h"
+
+#ifdef BT_NO_PARENT
+#error "treaps rotate through the parent link, drop BT_NO_PARENT"
+#endif
+
+/* Secret mixed into every priority, 0 until seeded */
+static unsigned long treap_key;
+
+/**
+ * treap_seed - Sets the secret mixed into every treap priority
+ * @seed: New secret, or 0 to draw a random one on next use; only change
+ *        it while no treap is in use
+ *
+ * Description: without a call, the secret is drawn from /dev/urandom the
+ * first time a priority is computed. Fixing it only makes shapes
+ * reproducible, for tests; a known secret lets insert order be tuned to
+ * degrade the treap into a list.
+ */
+void treap_seed(unsigned long seed)
+{
+    __atomic_store_n(&treap_key, seed, __ATOMIC_RELAXED);
+}
+
+/**
+ * treap_get_key - Returns the secret, drawing a random one on first use
+ *
+ * Description: falls back on the clock and the stack address, which
+ * varies under ASLR, when /dev/urandom cannot be read. Concurrent first
+ * uses agree on a single secret.
+ *
+ * Return: Non-zero secret
+ */
+static unsigned long treap_get_key(void)
+{
+    unsigned long key = __atomic_load_n(&treap_key, __ATOMIC_RELAXED);
+    unsigned long expected = 0;
+    int fd;
+
+    if (key != 0)
+        return (key);
+
+    fd = open("/dev/urandom", O_RDONLY);
+    if (fd < 0 || read(fd, &key, sizeof(key)) != (ssize_t)sizeof(key))
+        key = (unsigned long)time(NULL) * 0x9e3779b97f4a7c15UL ^
+              (unsigned long)&key;
+    if (fd >= 0)
+        close(fd);
+    key |= 1;
+
+    if (!__atomic_compare_exchange_n(&treap_key, &expected, key, 0,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        key = expected;
+
+    return (key);
+}
+
+/**
+ * treap_priority - Computes the heap priority of a key
+ * @value: Key of the node
+ *
+ * Description: splitmix64 of the key and the secret. Priorities live in
+ * no field, so treap nodes are plain bst_t nodes; the mix is a bijection,
+ * so distinct keys never tie.
+ *
+ * Return: Priority, higher sits closer to the root
+ */
+unsigned long treap_priority(int value)
+{
+    unsigned long x = (unsigned long)(unsigned int)value + treap_get_key();
+
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9UL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebUL;
+
+    return (x ^ (x >> 31));
+}
+
+/**
+ * treap_insert - Inserts a value in a treap
+ * @tree: Double pointer to the root node of the treap
+ * @value: Value to store in the node to be inserted
+ *
+ * Description: inserts as a leaf, then rotates the node up while its
+ * priority beats its parent's. Expected depth is O(log n) whatever the
+ * insertion order.
+ *
+ * Return: Pointer to the created node, or NULL on failure or duplicate
+ */
+bst_t *treap_insert(bst_t **tree, int value)
+{
+    bst_t *node, *parent;
+    unsigned long priority;
+
+    if (tree == NULL)
+        return (NULL);
+
+    node = bst_insert(tree, value);
+    if (node == NULL)
+        return (NULL);
+
+    priority = treap_priority(value);
+    while ((parent = node->parent) != NULL &&
+           priority > treap_priority(parent->n))
+    {
+        if (parent->left == node)
+            binary_tree_rotate_right(parent);
+        else
+            binary_tree_rotate_left(parent);
+    }
+    if (node->parent == NULL)
+        *tree = node;
+    /* The rotations changed the height, and hash, of every ancestor */
+    for (parent = node->parent; parent != NULL; parent = parent->parent)
+        BT_UPDATE(parent);
+
+    return (node);
+}
+
+/**
+ * treap_remove - Removes a value from a treap
+ * @root: Pointer to the root node of the treap
+ * @value: Value to remove
+ *
+ * Description: rotates the node down towards the higher-priority child
+ * until it has at most one child, then splices it out.
+ *
+ * Return: Pointer to the new root node of the treap
+ */
+bst_t *treap_remove(bst_t *root, int value)
+{
+    bst_t *node = bst_search(root, value), *child, *up;
+
+    if (node == NULL)
+        return (root);
+
+    while (node->left != NULL && node->right != NULL)
+    {
+        if (treap_priority(node->left->n) > treap_priority(node->right->n))
+            up = binary_tree_rotate_right(node);
+        else
+            up = binary_tree_rotate_left(node);
+        if (up->parent == NULL)
+            root = up;
+    }
+
+    child = node->left != NULL ? node->left : node->right;
+    up = node->parent;
+    if (child != NULL)
+        child->parent = up;
+    if (up == NULL)
+        root = child;
+    else if (up->left == node)
+        up->left = child;
+    else
+        up->right = child;
+    binary_tree_node_free(node);
+
+    for (; up != NULL; up = up->parent)
+        BT_UPDATE(up);
+
+    return (root);
+}
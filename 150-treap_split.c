@@ -0,0 +1,71 @@
+#include "binary_trees.h"
+
+#ifdef BT_NO_PARENT
+#error "treaps rotate through the parent link, drop BT_NO_PARENT"
+#endif
+
+/**
+ * treap_split - Splits a treap around a key
+ * @tree: Pointer to the root node of the treap, consumed
+ * @key: Split key
+ * @lo: Where to store the treap of the values smaller than key
+ * @hi: Where to store the treap of the values greater than or equal to key
+ *
+ * Description: walks one root-to-leaf path and relinks the existing nodes,
+ * expected O(log n).
+ */
+void treap_split(bst_t *tree, int key, bst_t **lo, bst_t **hi)
+{
+    if (tree == NULL)
+    {
+        *lo = NULL;
+        *hi = NULL;
+        return;
+    }
+
+    if (tree->n < key)
+    {
+        treap_split(tree->right, key, &tree->right, hi);
+        if (tree->right != NULL)
+            tree->right->parent = tree;
+        *lo = tree;
+    }
+    else
+    {
+        treap_split(tree->left, key, lo, &tree->left);
+        if (tree->left != NULL)
+            tree->left->parent = tree;
+        *hi = tree;
+    }
+    BT_UPDATE(tree);
+    tree->parent = NULL;
+}
+
+/**
+ * treap_merge - Concatenates two treaps
+ * @lo: Pointer to the root node of a treap, consumed
+ * @hi: Pointer to the root node of a treap whose values are all greater
+ *      than those of lo, consumed
+ *
+ * Return: Pointer to the root node of the merged treap, expected O(log n)
+ */
+bst_t *treap_merge(bst_t *lo, bst_t *hi)
+{
+    if (lo == NULL)
+        return (hi);
+    if (hi == NULL)
+        return (lo);
+
+    if (treap_priority(lo->n) > treap_priority(hi->n))
+    {
+        lo->right = treap_merge(lo->right, hi);
+        lo->right->parent = lo;
+        BT_UPDATE(lo);
+        return (lo);
+    }
+
+    hi->left = treap_merge(lo, hi->left);
+    hi->left->parent = hi;
+    BT_UPDATE(hi);
+    return (hi);
+}
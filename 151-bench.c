@@ -0,0 +1,152 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * bst_splay_search against bst_search on Zipfian lookup traces.
+ *
+ * gcc -O2 151-bench.c 151-bst_splay_search.c 111-bst_insert.c \
+ *     113-bst_search.c 103-binary_tree_rotate_left.c \
+ *     104-binary_tree_rotate_right.c 0-binary_tree_node.c \
+ *     3-binary_tree_delete.c -lm -o 151-bench
+ * ./151-bench [nb_keys] [nb_lookups]
+ *
+ * Both trees are built from the same shuffled keys. Lookups follow a Zipf
+ * law of exponent s over the keys, whose ranks are scattered so that hot
+ * keys are not neighbours. Output is CSV.
+ */
+
+/**
+ * xorshift - Advances a 64-bit xorshift generator
+ * @state: Pointer to the generator state
+ *
+ * Return: Next pseudo-random value
+ */
+static unsigned long xorshift(unsigned long *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return (*state);
+}
+
+/**
+ * zipf_trace - Draws lookup keys from a Zipf distribution
+ * @trace: Where to store the keys
+ * @nb_lookups: Number of keys to draw
+ * @nb_keys: Number of distinct keys, 0 to nb_keys - 1
+ * @s: Exponent of the distribution
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int zipf_trace(int *trace, size_t nb_lookups, size_t nb_keys, double s)
+{
+    double *cdf = malloc(nb_keys * sizeof(double)), total = 0, u;
+    unsigned long state = 88172645463325252UL;
+    size_t i, lo, hi, mid;
+
+    if (cdf == NULL)
+        return (-1);
+    for (i = 0; i < nb_keys; i++)
+        cdf[i] = (total += 1.0 / pow((double)(i + 1), s));
+    for (i = 0; i < nb_lookups; i++)
+    {
+        u = (double)(xorshift(&state) >> 11) / 9007199254740992.0 * total;
+        for (lo = 0, hi = nb_keys - 1; lo < hi;)
+        {
+            mid = (lo + hi) / 2;
+            if (cdf[mid] < u)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        trace[i] = (int)((lo * 2654435761UL) % nb_keys);
+    }
+    free(cdf);
+
+    return (0);
+}
+
+/**
+ * elapsed_ns - Nanoseconds since a start time
+ * @t0: Start time
+ *
+ * Return: Elapsed nanoseconds
+ */
+static double elapsed_ns(const struct timespec *t0)
+{
+    struct timespec t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return ((t1.tv_sec - t0->tv_sec) * 1e9 + (t1.tv_nsec - t0->tv_nsec));
+}
+
+/**
+ * main - Entry point
+ * @argc: Number of arguments
+ * @argv: Optional number of keys and number of lookups
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    const double exponents[] = {0.0, 0.8, 1.0, 1.2};
+    size_t nb_keys, nb_lookups, i, e;
+    unsigned long state = 42, found = 0;
+    bst_t *plain = NULL, *splay = NULL;
+    struct timespec t0;
+    int *keys, *trace, tmp;
+    double plain_ns, splay_ns;
+
+    nb_keys = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    nb_lookups = argc > 2 ? strtoul(argv[2], NULL, 10) : 5000000;
+    keys = malloc(nb_keys * sizeof(int));
+    trace = malloc(nb_lookups * sizeof(int));
+    if (keys == NULL || trace == NULL || nb_keys == 0)
+        return (1);
+
+    for (i = 0; i < nb_keys; i++)
+        keys[i] = (int)i;
+    for (i = nb_keys - 1; i > 0; i--)
+    {
+        e = xorshift(&state) % (i + 1);
+        tmp = keys[i];
+        keys[i] = keys[e];
+        keys[e] = tmp;
+    }
+
+    printf("zipf_s,keys,lookups,bst_search_ns,bst_splay_search_ns,speedup\n");
+    for (e = 0; e < sizeof(exponents) / sizeof(exponents[0]); e++)
+    {
+        for (i = 0; i < nb_keys; i++)
+        {
+            bst_insert(&plain, keys[i]);
+            bst_insert(&splay, keys[i]);
+        }
+        if (zipf_trace(trace, nb_lookups, nb_keys, exponents[e]) != 0)
+            return (1);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (i = 0; i < nb_lookups; i++)
+            found += bst_search(plain, trace[i]) != NULL;
+        plain_ns = elapsed_ns(&t0) / (double)nb_lookups;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (i = 0; i < nb_lookups; i++)
+            found += bst_splay_search(&splay, trace[i]) != NULL;
+        splay_ns = elapsed_ns(&t0) / (double)nb_lookups;
+
+        printf("%.1f,%lu,%lu,%.1f,%.1f,%.2f\n", exponents[e],
+               (unsigned long)nb_keys, (unsigned long)nb_lookups, plain_ns,
+               splay_ns, plain_ns / splay_ns);
+        binary_tree_delete(plain);
+        binary_tree_delete(splay);
+        plain = NULL;
+        splay = NULL;
+    }
+    free(keys);
+    free(trace);
+
+    return (found == 0);
+}
@@ -0,0 +1,82 @@
+#include "binary_trees.h"
+
+/**
+ * bst_splay - Moves a node to the root of its tree with splay steps
+ * @node: Pointer to the node to move up
+ *
+ * Description: zig-zig and zig-zag steps, built on the rotation
+ * functions, roughly halve the depth of every node on the access path.
+ *
+ * Return: node, which is now the root
+ */
+bst_t *bst_splay(bst_t *node)
+{
+    bst_t *parent, *grand;
+
+    while ((parent = node->parent) != NULL)
+    {
+        grand = parent->parent;
+        if (grand == NULL)
+        {
+            if (parent->left == node)
+                binary_tree_rotate_right(parent);
+            else
+                binary_tree_rotate_left(parent);
+        }
+        else if (grand->left == parent && parent->left == node)
+        {
+            binary_tree_rotate_right(grand);
+            binary_tree_rotate_right(parent);
+        }
+        else if (grand->right == parent && parent->right == node)
+        {
+            binary_tree_rotate_left(grand);
+            binary_tree_rotate_left(parent);
+        }
+        else if (parent->right == node)
+        {
+            binary_tree_rotate_left(parent);
+            binary_tree_rotate_right(grand);
+        }
+        else
+        {
+            binary_tree_rotate_right(parent);
+            binary_tree_rotate_left(grand);
+        }
+    }
+
+    return (node);
+}
+
+/**
+ * bst_splay_search - Searches a BST and splays the accessed node to the root
+ * @tree: Double pointer to the root node of the BST, updated
+ * @value: The value to search in the tree
+ *
+ * Description: frequently accessed values end up near the root, so the
+ * amortized cost of a lookup follows the access distribution. When the
+ * value is absent the last node visited is splayed instead.
+ *
+ * Return: A pointer to the node containing the value, or NULL if not found
+ */
+bst_t *bst_splay_search(bst_t **tree, int value)
+{
+    bst_t *node, *last = NULL;
+
+    if (tree == NULL)
+        return (NULL);
+
+    node = *tree;
+    while (node != NULL && node->n != value)
+    {
+        last = node;
+        node = value < node->n ? node->left : node->right;
+    }
+
+    if (node != NULL)
+        *tree = bst_splay(node);
+    else if (last != NULL)
+        *tree = bst_splay(last);
+
+    return (node);
+}
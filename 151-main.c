@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+
+    bst_splay_search(&tree, 62);
+    printf("Splayed 62...\n");
+    binary_tree_print(tree);
+
+    bst_splay_search(&tree, 1);
+    printf("Splayed 1...\n");
+    binary_tree_print(tree);
+    printf("Is BST: %d\n", binary_tree_is_bst(tree));
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,214 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+/**
+ * btree_node_new - Allocates an empty, cache-line aligned B+ tree root
+ * @leaf: 1 for a leaf, 0 for an internal node
+ *
+ * Return: Pointer to the node, or NULL on failure
+ */
+static btree_node_t *btree_node_new(int leaf)
+{
+    btree_node_t *node;
+
+    if (posix_memalign((void **)&node, 64, sizeof(*node)) != 0)
+        return (NULL);
+    memset(node, 0, sizeof(*node));
+    node->leaf = (unsigned short)leaf;
+
+    return (node);
+}
+
+/**
+ * btree_group_new - Allocates the child group of an internal node
+ *
+ * Description: BTREE_ORDER + 1 contiguous, cache-line aligned slots, the
+ * most children a node can have, so the group never has to grow.
+ *
+ * Return: Pointer to the first slot, or NULL on failure
+ */
+static btree_node_t *btree_group_new(void)
+{
+    btree_node_t *group;
+
+    if (posix_memalign((void **)&group, 64,
+                       (BTREE_ORDER + 1) * sizeof(*group)) != 0)
+        return (NULL);
+
+    return (group);
+}
+
+/**
+ * btree_split_child - Splits a full child of a non-full internal node
+ * @parent: Pointer to the parent node
+ * @i: Index of the full child
+ *
+ * Description: the later siblings shift one slot right in the parent's
+ * group to make room for the new right half. A leaf keeps its lower half
+ * and copies the first key of the upper half into the parent; an internal
+ * node moves its middle key up and hands its upper children to a new
+ * group, the only allocation.
+ *
+ * Return: 0 on success, -1 on failure with the tree unchanged
+ */
+static int btree_split_child(btree_node_t *parent, unsigned int i)
+{
+    btree_node_t *child = parent->children + i, *right, *group = NULL;
+    unsigned int half = BTREE_ORDER / 2;
+    int up;
+
+    if (!child->leaf)
+    {
+        group = btree_group_new();
+        if (group == NULL)
+            return (-1);
+    }
+
+    memmove(child + 2, child + 1,
+            (parent->count - i) * sizeof(btree_node_t));
+    right = child + 1;
+    right->leaf = child->leaf;
+    right->children = group;
+    if (child->leaf)
+    {
+        right->count = BTREE_ORDER - half;
+        memcpy(right->keys, child->keys + half, right->count * sizeof(int));
+        up = right->keys[0];
+    }
+    else
+    {
+        right->count = BTREE_ORDER - half - 1;
+        memcpy(right->keys, child->keys + half + 1,
+               right->count * sizeof(int));
+        memcpy(group, child->children + half + 1,
+               (right->count + 1) * sizeof(btree_node_t));
+        up = child->keys[half];
+    }
+    child->count = (unsigned short)half;
+
+    memmove(parent->keys + i + 1, parent->keys + i,
+            (parent->count - i) * sizeof(int));
+    parent->keys[i] = up;
+    parent->count++;
+
+    return (0);
+}
+
+/**
+ * btree_grow - Makes sure the root of a B+ tree has room for one more key
+ * @tree: Pointer to the tree
+ *
+ * Description: a full root is copied into the first slot of a new group
+ * under a new root, then split there.
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int btree_grow(btree_t *tree)
+{
+    btree_node_t *root;
+
+    if (tree->root == NULL)
+    {
+        tree->root = btree_node_new(1);
+        return (tree->root != NULL ? 0 : -1);
+    }
+    if (tree->root->count < BTREE_ORDER)
+        return (0);
+
+    root = btree_node_new(0);
+    if (root == NULL)
+        return (-1);
+    root->children = btree_group_new();
+    if (root->children == NULL)
+    {
+        free(root);
+        return (-1);
+    }
+    root->children[0] = *tree->root;
+    if (btree_split_child(root, 0) != 0)
+    {
+        free(root->children);
+        free(root);
+        return (-1);
+    }
+    free(tree->root);
+    tree->root = root;
+
+    return (0);
+}
+
+/**
+ * btree_insert - Inserts a value in a B+ tree
+ * @tree: Pointer to the tree
+ * @value: Value to insert
+ *
+ * Description: full nodes are split on the way down, so the leaf always
+ * has room and a failed allocation leaves a valid tree behind.
+ *
+ * Return: 1 if inserted, 0 if already present, -1 on failure
+ */
+int btree_insert(btree_t *tree, int value)
+{
+    btree_node_t *node;
+    unsigned int i;
+
+    if (tree == NULL || btree_grow(tree) != 0)
+        return (-1);
+
+    for (node = tree->root; !node->leaf; node = node->children + i)
+    {
+        i = btree_node_child(node, value);
+        if (node->children[i].count == BTREE_ORDER)
+        {
+            if (btree_split_child(node, i) != 0)
+                return (-1);
+            if (value >= node->keys[i])
+                i++;
+        }
+    }
+
+    i = btree_node_lower(node, value);
+    if (i < node->count && node->keys[i] == value)
+        return (0);
+    memmove(node->keys + i + 1, node->keys + i,
+            (node->count - i) * sizeof(int));
+    node->keys[i] = value;
+    node->count++;
+    tree->size++;
+
+    return (1);
+}
+
+/**
+ * btree_delete_node - Frees the groups below a B+ tree node
+ * @node: Pointer to the node, itself freed by the caller
+ */
+static void btree_delete_node(btree_node_t *node)
+{
+    unsigned int i;
+
+    if (node->leaf)
+        return;
+    for (i = 0; i <= node->count; i++)
+        btree_delete_node(node->children + i);
+    free(node->children);
+}
+
+/**
+ * btree_delete - Frees every node of a B+ tree
+ * @tree: Pointer to the tree, left empty
+ */
+void btree_delete(btree_t *tree)
+{
+    if (tree == NULL)
+        return;
+
+    if (tree->root != NULL)
+    {
+        btree_delete_node(tree->root);
+        free(tree->root);
+    }
+    tree->root = NULL;
+    tree->size = 0;
+}
@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+/**
+ * btree_borrow - Refills an underfull child from a sibling with spare keys
+ * @parent: Pointer to the parent node
+ * @i: Index of the underfull child
+ * @from_left: 1 to take from children[i - 1], 0 from children[i + 1]
+ *
+ * Description: an internal sibling hands over one child node, moved
+ * between the two groups; both have room since groups are full-sized.
+ */
+static void btree_borrow(btree_node_t *parent, unsigned int i, int from_left)
+{
+    btree_node_t *child = parent->children + i, *sib;
+
+    sib = parent->children + (from_left ? i - 1 : i + 1);
+    if (from_left)
+    {
+        memmove(child->keys + 1, child->keys, child->count * sizeof(int));
+        if (!child->leaf)
+            memmove(child->children + 1, child->children,
+                    (child->count + 1) * sizeof(btree_node_t));
+        child->keys[0] = child->leaf ? sib->keys[sib->count - 1]
+                                     : parent->keys[i - 1];
+        if (!child->leaf)
+            child->children[0] = sib->children[sib->count];
+        parent->keys[i - 1] = child->leaf ? child->keys[0]
+                                          : sib->keys[sib->count - 1];
+    }
+    else
+    {
+        child->keys[child->count] = child->leaf ? sib->keys[0]
+                                                : parent->keys[i];
+        if (!child->leaf)
+            child->children[child->count + 1] = sib->children[0];
+        parent->keys[i] = child->leaf ? sib->keys[1] : sib->keys[0];
+        memmove(sib->keys, sib->keys + 1, (sib->count - 1) * sizeof(int));
+        if (!sib->leaf)
+            memmove(sib->children, sib->children + 1,
+                    sib->count * sizeof(btree_node_t));
+    }
+    sib->count--;
+    child->count++;
+}
+
+/**
+ * btree_merge - Merges children[j + 1] into children[j]
+ * @parent: Pointer to the parent node
+ * @j: Index of the left child of the pair
+ *
+ * Description: the right node's children join the left node's group and
+ * its own group is freed; the later siblings shift one slot left.
+ */
+static void btree_merge(btree_node_t *parent, unsigned int j)
+{
+    btree_node_t *left = parent->children + j, *right = left + 1;
+
+    if (!left->leaf)
+    {
+        left->keys[left->count++] = parent->keys[j];
+        memcpy(left->children + left->count, right->children,
+               (right->count + 1) * sizeof(btree_node_t));
+        free(right->children);
+    }
+    memcpy(left->keys + left->count, right->keys, right->count * sizeof(int));
+    left->count += right->count;
+
+    memmove(parent->keys + j, parent->keys + j + 1,
+            (parent->count - j - 1) * sizeof(int));
+    memmove(right, right + 1, (parent->count - j - 1) * sizeof(btree_node_t));
+    parent->count--;
+}
+
+/**
+ * btree_fix - Restores the minimum fill of an underfull child
+ * @parent: Pointer to the parent node
+ * @i: Index of the underfull child
+ */
+static void btree_fix(btree_node_t *parent, unsigned int i)
+{
+    btree_node_t *left = i > 0 ? parent->children + i - 1 : NULL;
+    btree_node_t *right = i < parent->count ? parent->children + i + 1 : NULL;
+
+    if (left != NULL && left->count > BTREE_MIN(left))
+        btree_borrow(parent, i, 1);
+    else if (right != NULL && right->count > BTREE_MIN(right))
+        btree_borrow(parent, i, 0);
+    else if (left != NULL)
+        btree_merge(parent, i - 1);
+    else
+        btree_merge(parent, i);
+}
+
+/**
+ * btree_rem - Recursive helper of btree_remove
+ * @node: Pointer to the subtree root
+ * @value: Value to remove
+ *
+ * Description: separators equal to a removed key are left in place, they
+ * still route correctly since every key on their right stays larger.
+ *
+ * Return: 1 if removed, 0 if absent
+ */
+static int btree_rem(btree_node_t *node, int value)
+{
+    unsigned int i;
+
+    if (node->leaf)
+    {
+        i = btree_node_lower(node, value);
+        if (i == node->count || node->keys[i] != value)
+            return (0);
+        memmove(node->keys + i, node->keys + i + 1,
+                (node->count - i - 1) * sizeof(int));
+        node->count--;
+        return (1);
+    }
+
+    i = btree_node_child(node, value);
+    if (!btree_rem(node->children + i, value))
+        return (0);
+    if (node->children[i].count < BTREE_MIN(node->children + i))
+        btree_fix(node, i);
+
+    return (1);
+}
+
+/**
+ * btree_remove - Removes a value from a B+ tree
+ * @tree: Pointer to the tree
+ * @value: Value to remove
+ *
+ * Return: 1 if removed, 0 if absent
+ */
+int btree_remove(btree_t *tree, int value)
+{
+    btree_node_t *root, *group;
+
+    if (tree == NULL || tree->root == NULL || !btree_rem(tree->root, value))
+        return (0);
+
+    tree->size--;
+    root = tree->root;
+    if (root->count == 0 && root->leaf)
+    {
+        free(root);
+        tree->root = NULL;
+    }
+    else if (root->count == 0)
+    {
+        /* The only child moves up into the root's own allocation */
+        group = root->children;
+        *root = group[0];
+        free(group);
+    }
+
+    return (1);
+}
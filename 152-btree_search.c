@@ -0,0 +1,141 @@
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "binary_trees.h"
+
+/**
+ * btree_node_lower - Counts the keys of a node smaller than a value
+ * @node: Pointer to the node
+ * @value: Value to compare against
+ *
+ * Description: compares the whole 64-byte node at once, with two AVX2 or
+ * four SSE2 compares, then masks off the unused key slots and the count
+ * and link words. Builds without SSE2 fall back to a scalar loop.
+ *
+ * Return: Index of the first key greater than or equal to value
+ */
+unsigned int btree_node_lower(const btree_node_t *node, int value)
+{
+    unsigned int mask;
+#if defined(__AVX2__)
+    __m256i v = _mm256_set1_epi32(value);
+    __m256i lo = _mm256_load_si256((const __m256i *)node);
+    __m256i hi = _mm256_load_si256((const __m256i *)node + 1);
+
+    mask = (unsigned int)_mm256_movemask_ps(
+               _mm256_castsi256_ps(_mm256_cmpgt_epi32(v, lo))) |
+           (unsigned int)_mm256_movemask_ps(
+               _mm256_castsi256_ps(_mm256_cmpgt_epi32(v, hi))) << 8;
+#elif defined(__SSE2__)
+    __m128i v = _mm_set1_epi32(value);
+    const __m128i *keys = (const __m128i *)node;
+    unsigned int i;
+
+    for (mask = 0, i = 0; i < BTREE_LINE / 4; i++)
+        mask |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(
+                    _mm_cmpgt_epi32(v, _mm_load_si128(keys + i)))) << (4 * i);
+#else
+    unsigned int i;
+
+    for (mask = 0, i = 0; i < node->count; i++)
+        mask |= (unsigned int)(node->keys[i] < value) << i;
+#endif
+
+    return ((unsigned int)__builtin_popcount(mask &
+                                             ((1U << node->count) - 1)));
+}
+
+/**
+ * btree_node_child - Picks the child of an internal node that covers a value
+ * @node: Pointer to the internal node
+ * @value: Value to route
+ *
+ * Return: Index of the child
+ */
+unsigned int btree_node_child(const btree_node_t *node, int value)
+{
+    unsigned int i = btree_node_lower(node, value);
+
+    if (i < node->count && node->keys[i] == value)
+        i++;
+
+    return (i);
+}
+
+/**
+ * btree_search - Searches for a value in a B+ tree
+ * @tree: Pointer to the tree
+ * @value: The value to search in the tree
+ *
+ * Return: 1 if the value is present, 0 otherwise
+ */
+int btree_search(const btree_t *tree, int value)
+{
+    const btree_node_t *node;
+    unsigned int i;
+
+    if (tree == NULL || tree->root == NULL)
+        return (0);
+
+    for (node = tree->root; !node->leaf;)
+        node = node->children + btree_node_child(node, value);
+    i = btree_node_lower(node, value);
+
+    return (i < node->count && node->keys[i] == value);
+}
+
+/**
+ * btree_range_node - Visits the values of a subtree within a closed range
+ * @node: Pointer to the subtree root
+ * @lo: Smallest value to visit
+ * @hi: Largest value to visit
+ * @func: Function called with each value in ascending order, may be NULL
+ *
+ * Description: only the children whose key interval meets [lo, hi] are
+ * entered; leaves carry no sibling link, so the scan walks back up.
+ *
+ * Return: Number of values in [lo, hi]
+ */
+static size_t btree_range_node(const btree_node_t *node, int lo, int hi,
+                               void (*func)(int))
+{
+    size_t count = 0;
+    unsigned int i, last;
+
+    if (node->leaf)
+    {
+        for (i = btree_node_lower(node, lo);
+             i < node->count && node->keys[i] <= hi; i++)
+        {
+            if (func != NULL)
+                func(node->keys[i]);
+            count++;
+        }
+        return (count);
+    }
+
+    last = btree_node_child(node, hi);
+    for (i = btree_node_child(node, lo); i <= last; i++)
+        count += btree_range_node(node->children + i, lo, hi, func);
+
+    return (count);
+}
+
+/**
+ * btree_range - Visits the values of a B+ tree within a closed range
+ * @tree: Pointer to the tree
+ * @lo: Smallest value to visit
+ * @hi: Largest value to visit
+ * @func: Function called with each value in ascending order, may be NULL
+ *
+ * Return: Number of values in [lo, hi]
+ */
+size_t btree_range(const btree_t *tree, int lo, int hi, void (*func)(int))
+{
+    if (tree == NULL || tree->root == NULL || lo > hi)
+        return (0);
+
+    return (btree_range_node(tree->root, lo, hi, func));
+}
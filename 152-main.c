@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_value - Prints one value of a range scan
+ * @n: Value to print
+ */
+static void print_value(int n)
+{
+    printf(" %d", n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    btree_t tree = {NULL, 0};
+    int i;
+
+    for (i = 0; i < 1000; i++)
+        if (btree_insert(&tree, (i * 7919) % 1000) == -1)
+            return (1);
+    printf("Size: %lu, node size: %lu bytes\n", (unsigned long)tree.size,
+           (unsigned long)sizeof(btree_node_t));
+    printf("Search 500: %d, search 1000: %d\n", btree_search(&tree, 500),
+           btree_search(&tree, 1000));
+
+    for (i = 0; i < 1000; i += 2)
+        btree_remove(&tree, i);
+    printf("Range [100, 120]:");
+    btree_range(&tree, 100, 120, print_value);
+    printf("\nSize: %lu\n", (unsigned long)tree.size);
+    btree_delete(&tree);
+    return (0);
+}
@@ -0,0 +1,90 @@
+#include "binary_trees.h"
+
+/**
+ * heap_meld - Melds two skew heaps into one
+ * @a: Root of the first heap, consumed
+ * @b: Root of the second heap, consumed
+ *
+ * Description: walks down the right spines of both heaps, linking the
+ * root HEAP_HIGHER ranks first each time and swapping its children so the
+ * merged path is pushed to the left. Self-adjusting, O(log n) amortized
+ * with no balance information stored in the nodes, and iterative so long
+ * paths cannot overflow the stack.
+ *
+ * Return: Root of the melded heap
+ */
+heap_t *heap_meld(heap_t *a, heap_t *b)
+{
+    heap_t *root = NULL, **link = &root, *parent = NULL, *temp;
+
+    while (a != NULL && b != NULL)
+    {
+        BT_STAT_ADD(comparisons, 1);
+        BT_STAT_ADD(visits, 1);
+        if (HEAP_HIGHER(b->n, a->n))
+        {
+            temp = a;
+            a = b;
+            b = temp;
+        }
+        *link = a;
+        BT_SET_PARENT(a, parent);
+        parent = a;
+        temp = a->right;
+        a->right = a->left;
+        a->left = temp;
+        link = &a->left;
+        a = temp;
+    }
+
+    temp = a != NULL ? a : b;
+    *link = temp;
+    if (temp != NULL)
+        BT_SET_PARENT(temp, parent);
+
+    return (root);
+}
+
+/**
+ * meld_heap_insert - Inserts a value in a meldable heap
+ * @root: Pointer to the root node of the heap
+ * @value: The value to store in the node to be inserted
+ *
+ * Return: Pointer to the inserted node, or NULL on failure
+ */
+heap_t *meld_heap_insert(heap_t **root, int value)
+{
+    heap_t *new_node;
+
+    if (root == NULL)
+        return (NULL);
+
+    new_node = binary_tree_node(NULL, value);
+    if (new_node == NULL)
+        return (NULL);
+
+    *root = heap_meld(*root, new_node);
+    return (new_node);
+}
+
+/**
+ * meld_heap_extract - Extracts the root node of a meldable heap
+ * @root: Pointer to the root node of the heap
+ *
+ * Return: Value stored in the root node, or 0 on failure
+ */
+int meld_heap_extract(heap_t **root)
+{
+    heap_t *node;
+    int value;
+
+    if (root == NULL || *root == NULL)
+        return (0);
+
+    node = *root;
+    value = node->n;
+    *root = heap_meld(node->left, node->right);
+    binary_tree_node_free(node);
+
+    return (value);
+}
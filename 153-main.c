@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 1000
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    heap_t *even = NULL, *odd = NULL, *heap;
+    int i, prev, value, sorted = 1;
+
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        if (meld_heap_insert(i % 2 ? &odd : &even, (i * 7919) % NB_KEYS)
+            == NULL)
+            return (1);
+    }
+    printf("Even heap top: %d, odd heap top: %d\n", even->n, odd->n);
+
+    heap = heap_meld(even, odd);
+    printf("Melded heap size: %lu, top: %d\n",
+           (unsigned long)binary_tree_size(heap), heap->n);
+
+    prev = meld_heap_extract(&heap);
+    while (heap != NULL)
+    {
+        value = meld_heap_extract(&heap);
+        if (HEAP_HIGHER(value, prev))
+            sorted = 0;
+        prev = value;
+    }
+    printf("Extracted in heap order: %d\n", sorted);
+    return (0);
+}
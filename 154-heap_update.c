@@ -0,0 +1,84 @@
+#include "binary_trees.h"
+
+/**
+ * heap_update_key - Changes the value of a node of a Binary Heap ordered
+ *                   by HEAP_HIGHER
+ * @root: Pointer to the root node of the heap
+ * @node: Handle returned by heap_insert
+ * @value: New value of the node
+ *
+ * Description: the node is sifted up when HEAP_HIGHER ranks the new value
+ * above the old one and down otherwise, in O(log n). The handle stays valid.
+ *
+ * Return: @node, or NULL on failure
+ */
+heap_t *heap_update_key(heap_t **root, heap_t *node, int value)
+{
+    int old;
+
+    if (root == NULL || *root == NULL || node == NULL)
+        return (NULL);
+
+    old = node->n;
+    node->n = value;
+    if (HEAP_HIGHER(value, old))
+        heapify_up(root, node);
+    else
+        heapify_down(root, node);
+
+    return (node);
+}
+
+/**
+ * heap_remove - Removes any node of a Binary Heap ordered by HEAP_HIGHER
+ * @root: Pointer to the root node of the heap
+ * @node: Handle returned by heap_insert, freed by this function
+ *
+ * Description: the last node of the heap takes the place of @node and is
+ * sifted up or down from there. Finding the last node means measuring the
+ * heap with heap_size, so the whole call is O(log^2 n), the same as
+ * heap_insert and heap_extract. Other handles stay valid.
+ *
+ * Return: Value stored in the removed node, or 0 on failure
+ */
+int heap_remove(heap_t **root, heap_t *node)
+{
+    heap_t *last;
+    int value;
+
+    if (root == NULL || *root == NULL || node == NULL)
+        return (0);
+
+    value = node->n;
+    last = heap_node_at(*root, heap_size(*root));
+    if (last->parent == NULL)
+        *root = NULL;
+    else if (last->parent->left == last)
+        last->parent->left = NULL;
+    else
+        last->parent->right = NULL;
+
+    if (last != node)
+    {
+        last->parent = node->parent;
+        last->left = node->left;
+        last->right = node->right;
+        if (last->left != NULL)
+            last->left->parent = last;
+        if (last->right != NULL)
+            last->right->parent = last;
+        if (node->parent == NULL)
+            *root = last;
+        else if (node->parent->left == node)
+            node->parent->left = last;
+        else
+            node->parent->right = last;
+        if (HEAP_HIGHER(last->n, value))
+            heapify_up(root, last);
+        else
+            heapify_down(root, last);
+    }
+    binary_tree_node_free(node);
+
+    return (value);
+}
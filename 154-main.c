@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 1000
+
+/**
+ * check - Checks parent links and the HEAP_HIGHER order
+ * @node: Pointer to the root of the subtree
+ *
+ * Return: 1 if the subtree is a valid heap, 0 otherwise
+ */
+static int check(const heap_t *node)
+{
+    if (node == NULL)
+        return (1);
+    if (node->left != NULL &&
+        (node->left->parent != node || node->left->n > node->n))
+        return (0);
+    if (node->right != NULL &&
+        (node->right->parent != node || node->right->n > node->n))
+        return (0);
+    return (check(node->left) && check(node->right));
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    heap_t *heap = NULL, *handles[NB_KEYS];
+    int i, ok = 1;
+
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        handles[i] = heap_insert(&heap, i);
+        if (handles[i] == NULL)
+            return (1);
+    }
+    for (i = 0; i < NB_KEYS; i++)
+        ok &= handles[i]->n == i;
+    printf("Handles stable after inserts: %d\n", ok);
+
+    for (i = 0; i < NB_KEYS; i += 3)
+        heap_update_key(&heap, handles[i], NB_KEYS - i);
+    for (i = 1; i < NB_KEYS; i += 3)
+        heap_update_key(&heap, handles[i], -i);
+    printf("Top after updates: %d, valid: %d\n", heap->n, check(heap));
+
+    for (i = 2; i < NB_KEYS; i += 3)
+        heap_remove(&heap, handles[i]);
+    printf("Size after removals: %lu, valid: %d\n",
+           (unsigned long)heap_size(heap), check(heap));
+
+    ok = 1;
+    for (i = 0; i < NB_KEYS; i += 3)
+        ok &= handles[i]->n == NB_KEYS - i;
+    printf("Handles stable after removals: %d\n", ok);
+
+    printf("Extracted: %d", heap_extract(&heap));
+    printf(" %d", heap_extract(&heap));
+    printf(" %d\n", heap_extract(&heap));
+    binary_tree_delete(heap);
+    return (0);
+}
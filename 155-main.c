@@ -0,0 +1,61 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+#include "binary_trees_generic.h"
+
+/**
+ * struct deadline_s - Timer ordered by deadline, then by id
+ *
+ * @deadline: Expiry time
+ * @id: Tie breaker
+ */
+typedef struct deadline_s
+{
+    unsigned long deadline;
+    int id;
+} deadline_t;
+
+#define TIMER_EARLIER(x, y) ((x).deadline < (y).deadline || \
+                             ((x).deadline == (y).deadline && (x).id < (y).id))
+
+BT_DEFINE_MIN_HEAP(umin_heap, unsigned long)
+BT_DEFINE_HEAP(timer_heap, deadline_t, TIMER_EARLIER)
+
+/**
+ * main - Entry point, build with and without -DHEAP_MIN to see both orders
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    int values[] = {34, 2, 98, 21, 62, 1, 47};
+    unsigned long u;
+    umin_heap_t *uheap = NULL;
+    timer_heap_t *timers = NULL;
+    deadline_t timer;
+    heap_t *heap = NULL;
+    size_t i;
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        if (heap_insert(&heap, values[i]) == NULL ||
+            umin_heap_insert(&uheap, (unsigned long)values[i]) == NULL)
+            return (1);
+        timer.deadline = (unsigned long)values[i] % 10;
+        timer.id = (int)i;
+        if (timer_heap_insert(&timers, timer) == NULL)
+            return (1);
+    }
+
+    printf("heap_t (%s):", HEAP_HIGHER(1, 0) ? "max" : "min");
+    while (heap != NULL)
+        printf(" %d", heap_extract(&heap));
+    printf("\numin_heap:");
+    while (umin_heap_extract(&uheap, &u))
+        printf(" %lu", u);
+    printf("\ntimer_heap:");
+    while (timer_heap_extract(&timers, &timer))
+        printf(" %lu/%d", timer.deadline, timer.id);
+    printf("\n");
+    return (0);
+}
@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <string.h>
+#include "binary_trees.h"
+
+/**
+ * topk_sift_down - Restores the heap below a slot, lowest value on top
+ * @array: Heap stored in level order
+ * @size: Number of values in @array
+ * @value: Value to place, starting from slot 0
+ */
+static void topk_sift_down(int *array, size_t size, int value)
+{
+    size_t i, child;
+
+    for (i = 0; (child = 2 * i + 1) < size; i = child)
+    {
+        if (child + 1 < size && HEAP_HIGHER(array[child], array[child + 1]))
+            child++;
+        if (!HEAP_HIGHER(value, array[child]))
+            break;
+        array[i] = array[child];
+    }
+    array[i] = value;
+}
+
+/**
+ * heap_topk_init - Prepares an empty bounded heap
+ * @topk: Pointer to the bounded heap
+ * @k: Number of values to keep
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int heap_topk_init(heap_topk_t *topk, size_t k)
+{
+    if (topk == NULL || k == 0)
+        return (0);
+
+    topk->array = malloc(k * sizeof(int));
+    if (topk->array == NULL)
+        return (0);
+    topk->size = 0;
+    topk->k = k;
+
+    return (1);
+}
+
+/**
+ * heap_topk_free - Releases the buffer of a bounded heap
+ * @topk: Pointer to the bounded heap
+ */
+void heap_topk_free(heap_topk_t *topk)
+{
+    if (topk == NULL)
+        return;
+
+    free(topk->array);
+    topk->array = NULL;
+    topk->size = 0;
+    topk->k = 0;
+}
+
+/**
+ * heap_topk_push - Offers a value to a bounded heap
+ * @topk: Pointer to the bounded heap
+ * @value: Value to offer
+ *
+ * Description: once k values are kept, a value that is not higher than the
+ * lowest of them is rejected with one comparison; otherwise it replaces
+ * that value in O(log k). No allocation happens after heap_topk_init.
+ *
+ * Return: 1 if the value is kept, 0 if it is rejected
+ */
+int heap_topk_push(heap_topk_t *topk, int value)
+{
+    size_t i, parent;
+
+    if (topk == NULL || topk->k == 0)
+        return (0);
+
+    if (topk->size == topk->k)
+    {
+        if (!HEAP_HIGHER(value, topk->array[0]))
+            return (0);
+        topk_sift_down(topk->array, topk->size, value);
+        return (1);
+    }
+
+    for (i = topk->size++; i > 0; i = parent)
+    {
+        parent = (i - 1) / 2;
+        if (!HEAP_HIGHER(topk->array[parent], value))
+            break;
+        topk->array[i] = topk->array[parent];
+    }
+    topk->array[i] = value;
+
+    return (1);
+}
+
+/**
+ * heap_topk_result - Copies the kept values, highest first
+ * @topk: Pointer to the bounded heap, left unchanged
+ * @out: Array of at least topk->size values
+ *
+ * Return: Number of values written to @out
+ */
+size_t heap_topk_result(const heap_topk_t *topk, int *out)
+{
+    size_t size;
+    int last;
+
+    if (topk == NULL || out == NULL)
+        return (0);
+
+    memcpy(out, topk->array, topk->size * sizeof(int));
+    for (size = topk->size; size > 1; size--)
+    {
+        last = out[size - 1];
+        out[size - 1] = out[0];
+        topk_sift_down(out, size - 1, last);
+    }
+
+    return (topk->size);
+}
+
+/**
+ * heap_topk_merge - Offers the values kept by one bounded heap to another
+ * @dst: Bounded heap receiving the values
+ * @src: Bounded heap to merge, left unchanged
+ *
+ * Description: used to combine per-thread bounded heaps once their streams
+ * are consumed, in O(k log k).
+ */
+void heap_topk_merge(heap_topk_t *dst, const heap_topk_t *src)
+{
+    size_t i;
+
+    if (dst == NULL || src == NULL)
+        return;
+
+    for (i = 0; i < src->size; i++)
+        heap_topk_push(dst, src->array[i]);
+}
@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_EVENTS 1000000
+#define K 10
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    heap_topk_t streams[2];
+    int out[K];
+    unsigned long x = 2463534242UL;
+    size_t i, n, kept = 0;
+
+    if (!heap_topk_init(&streams[0], K) || !heap_topk_init(&streams[1], K))
+        return (1);
+
+    for (i = 0; i < NB_EVENTS; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        kept += heap_topk_push(&streams[i % 2], (int)(x % 1000000000));
+    }
+    printf("Events: %d, kept at some point: %lu\n", NB_EVENTS,
+           (unsigned long)kept);
+
+    heap_topk_merge(&streams[0], &streams[1]);
+    n = heap_topk_result(&streams[0], out);
+    printf("Top %lu:", (unsigned long)n);
+    for (i = 0; i < n; i++)
+        printf(" %d", out[i]);
+    printf("\n");
+
+    heap_topk_free(&streams[0]);
+    heap_topk_free(&streams[1]);
+    return (0);
+}
@@ -0,0 +1,149 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+/**
+ * frontier_reserve - Makes room for two more nodes in the frontier
+ * @it: Pointer to the iterator
+ *
+ * Return: 1 on success, 0 on allocation failure
+ */
+static int frontier_reserve(heap_iter_t *it)
+{
+    const heap_t **frontier;
+    size_t capacity;
+
+    if (it->size + 2 <= it->capacity)
+        return (1);
+
+    capacity = it->capacity ? it->capacity * 2 : 16;
+    frontier = realloc(it->frontier, capacity * sizeof(*frontier));
+    if (frontier == NULL)
+        return (0);
+    it->frontier = frontier;
+    it->capacity = capacity;
+
+    return (1);
+}
+
+/**
+ * frontier_push - Adds a node to the frontier of an iterator
+ * @it: Pointer to the iterator, with room for the node
+ * @node: Node to add, ignored if NULL
+ */
+static void frontier_push(heap_iter_t *it, const heap_t *node)
+{
+    size_t i, parent;
+
+    if (node == NULL)
+        return;
+
+    for (i = it->size++; i > 0; i = parent)
+    {
+        parent = (i - 1) / 2;
+        if (!HEAP_HIGHER(node->n, it->frontier[parent]->n))
+            break;
+        it->frontier[i] = it->frontier[parent];
+    }
+    it->frontier[i] = node;
+}
+
+/**
+ * frontier_pop - Removes the highest node from the frontier of an iterator
+ * @it: Pointer to the iterator, with a non-empty frontier
+ *
+ * Return: The removed node
+ */
+static const heap_t *frontier_pop(heap_iter_t *it)
+{
+    const heap_t *top = it->frontier[0], *last = it->frontier[--it->size];
+    size_t i, child;
+
+    for (i = 0; (child = 2 * i + 1) < it->size; i = child)
+    {
+        if (child + 1 < it->size &&
+            HEAP_HIGHER(it->frontier[child + 1]->n, it->frontier[child]->n))
+            child++;
+        if (!HEAP_HIGHER(it->frontier[child]->n, last->n))
+            break;
+        it->frontier[i] = it->frontier[child];
+    }
+    it->frontier[i] = last;
+
+    return (top);
+}
+
+/**
+ * heap_iter_init - Starts iterating over a heap in heap order
+ * @it: Pointer to the iterator
+ * @root: Pointer to the root node of the heap
+ * @keep: 0 to extract the yielded values from the heap, 1 to leave the heap
+ *        intact and track the next candidates in a frontier heap instead
+ *
+ * Description: nothing is sorted up front; each heap_iter_next costs
+ * O(log n) when draining, O(log k) after k values when keeping the heap.
+ * A kept heap must not be modified while the iterator is in use.
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int heap_iter_init(heap_iter_t *it, heap_t **root, int keep)
+{
+    if (it == NULL || root == NULL)
+        return (0);
+
+    it->root = keep ? NULL : root;
+    it->frontier = NULL;
+    it->size = 0;
+    it->capacity = 0;
+    if (keep && *root != NULL)
+    {
+        if (!frontier_reserve(it))
+            return (0);
+        frontier_push(it, *root);
+    }
+
+    return (1);
+}
+
+/**
+ * heap_iter_next - Yields the next value of a heap in heap order
+ * @it: Pointer to the iterator
+ * @value: Pointer to store the value
+ *
+ * Return: 1 if a value was yielded, 0 at the end, -1 on allocation failure
+ * (the iterator is left unchanged and the call can be retried)
+ */
+int heap_iter_next(heap_iter_t *it, int *value)
+{
+    const heap_t *node;
+
+    if (it->root != NULL)
+    {
+        if (*it->root == NULL)
+            return (0);
+        *value = heap_extract(it->root);
+        return (1);
+    }
+
+    if (it->size == 0)
+        return (0);
+    if (!frontier_reserve(it))
+        return (-1);
+    node = frontier_pop(it);
+    *value = node->n;
+    frontier_push(it, node->left);
+    frontier_push(it, node->right);
+
+    return (1);
+}
+
+/**
+ * heap_iter_free - Releases the frontier of an iterator
+ * @it: Pointer to the iterator
+ */
+void heap_iter_free(heap_iter_t *it)
+{
+    free(it->frontier);
+    it->frontier = NULL;
+    it->size = 0;
+    it->capacity = 0;
+}
@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 100000
+#define NB_WANTED 5
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    heap_t *heap = NULL;
+    heap_iter_t it;
+    int i, value;
+
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        if (heap_insert(&heap, (i * 7919) % NB_KEYS) == NULL)
+            return (1);
+    }
+
+    if (!heap_iter_init(&it, &heap, 1))
+        return (1);
+    printf("Kept:");
+    for (i = 0; i < NB_WANTED && heap_iter_next(&it, &value) == 1; i++)
+        printf(" %d", value);
+    printf(", frontier: %lu, heap size: %lu\n", (unsigned long)it.size,
+           (unsigned long)heap_size(heap));
+    heap_iter_free(&it);
+
+    heap_iter_init(&it, &heap, 0);
+    printf("Drained:");
+    for (i = 0; i < NB_WANTED && heap_iter_next(&it, &value) == 1; i++)
+        printf(" %d", value);
+    printf(", heap size: %lu\n", (unsigned long)heap_size(heap));
+    heap_iter_free(&it);
+
+    binary_tree_delete(heap);
+    return (0);
+}
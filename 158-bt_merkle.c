@@ -0,0 +1,88 @@
+#include "binary_trees.h"
+
+#ifndef BT_MERKLE
+#error "158-bt_merkle.c needs the hash field, build with -DBT_MERKLE"
+#endif
+
+/**
+ * bt_merkle_hash - Hashes a node from its value and its children's hashes
+ * @n: Value of the node
+ * @state: Other hashed state of the node, BT_HASH_STATE, 0 if none
+ * @left: Hash of the left subtree, 0 if empty
+ * @right: Hash of the right subtree, 0 if empty
+ *
+ * Description: splitmix64 finalisers; left and right are mixed with
+ * different constants so mirrored trees do not collide.
+ *
+ * Return: Hash of the subtree, never 0
+ */
+unsigned long bt_merkle_hash(int n, unsigned long state, unsigned long left,
+                             unsigned long right)
+{
+    unsigned long x = (unsigned long)(unsigned int)n;
+
+    x ^= state * 0xd6e8feb86659fd93UL;
+    x ^= left * 0x9e3779b97f4a7c15UL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9UL;
+    x ^= right * 0xc2b2ae3d27d4eb4fUL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebUL;
+    x ^= x >> 31;
+
+    return (x != 0 ? x : 1);
+}
+
+/**
+ * bt_merkle_equal - Compares two trees by their root hashes
+ * @a: Root of the first tree
+ * @b: Root of the second tree
+ *
+ * Description: equal hashes mean, up to a 64-bit collision, the same
+ * values in the same shape. Trees whose shape only depends on their keys,
+ * such as treaps sharing a seed, compare equal as sets.
+ *
+ * Return: 1 if the trees hash the same, 0 otherwise, in O(1)
+ */
+int bt_merkle_equal(const binary_tree_t *a, const binary_tree_t *b)
+{
+    return (BT_HASH(a) == BT_HASH(b));
+}
+
+/**
+ * bt_merkle_diff - Reports the positions where two trees differ
+ * @a: Root of the first tree
+ * @b: Root of the second tree
+ * @func: Called with each pair of nodes found at the same position with
+ *        different values or BT_HASH_STATE, such as counts or tombstones,
+ *        or with NULL for the side where a subtree is missing; may be NULL
+ *        to only count them
+ *
+ * Description: subtrees whose hashes match are skipped without being
+ * visited, so the cost follows the size of the difference, not the size
+ * of the trees. A missing subtree is reported once, at its root.
+ *
+ * Return: Number of pairs reported
+ */
+size_t bt_merkle_diff(const binary_tree_t *a, const binary_tree_t *b,
+                      void (*func)(const binary_tree_t *,
+                                   const binary_tree_t *))
+{
+    size_t count = 0;
+
+    if (BT_HASH(a) == BT_HASH(b))
+        return (0);
+
+    if (a == NULL || b == NULL || a->n != b->n ||
+        BT_HASH_STATE(a) != BT_HASH_STATE(b))
+    {
+        if (func != NULL)
+            func(a, b);
+        count++;
+        if (a == NULL || b == NULL)
+            return (count);
+    }
+
+    count += bt_merkle_diff(a->left, b->left, func);
+    count += bt_merkle_diff(a->right, b->right, func);
+
+    return (count);
+}
@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 10000
+
+/**
+ * print_diff - Prints one position where two trees differ
+ * @a: Node of the first tree, NULL if absent
+ * @b: Node of the second tree, NULL if absent
+ */
+static void print_diff(const binary_tree_t *a, const binary_tree_t *b)
+{
+    if (a == NULL)
+        printf("  missing on the left: %d\n", b->n);
+    else if (b == NULL)
+        printf("  missing on the right: %d\n", a->n);
+    else
+        printf("  %d vs %d\n", a->n, b->n);
+}
+
+/**
+ * main - Entry point, build with -DBT_MERKLE
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *a = NULL, *b = NULL;
+    int i;
+
+    treap_seed(42);
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        if (treap_insert(&a, i) == NULL ||
+            treap_insert(&b, NB_KEYS - 1 - i) == NULL)
+            return (1);
+    }
+    printf("Same keys, different insert order, equal: %d\n",
+           bt_merkle_equal(a, b));
+
+    b = treap_remove(b, 1234);
+    printf("After removing 1234 from b, equal: %d\n", bt_merkle_equal(a, b));
+    printf("Differences: %lu\n", (unsigned long)bt_merkle_diff(a, b, NULL));
+
+    a = treap_remove(a, 1234);
+    treap_insert(&a, NB_KEYS + 1);
+    treap_insert(&b, NB_KEYS + 2);
+    printf("After one insert on each side:\n");
+    bt_merkle_diff(a, b, print_diff);
+
+    binary_tree_delete(a);
+    binary_tree_delete(b);
+    return (0);
+}
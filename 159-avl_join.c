@@ -0,0 +1,157 @@
+#include "binary_trees.h"
+
+/**
+ * avl_retrace - Rebalances every node from one node up to the root
+ * @node: Lowest node whose subtree changed, not NULL
+ *
+ * Return: Pointer to the root node of the tree
+ */
+static avl_t *avl_retrace(avl_t *node)
+{
+    avl_t *parent, *top = node;
+
+    for (; node != NULL; node = parent)
+    {
+        parent = node->parent;
+        top = avl_rebalance(node);
+    }
+
+    return (top);
+}
+
+/**
+ * avl_join3 - Joins two AVL trees around a middle node
+ * @lo: Root of an AVL tree whose keys are all lower than @mid's, or NULL
+ * @mid: Detached node
+ * @hi: Root of an AVL tree whose keys are all higher than @mid's, or NULL
+ *
+ * Description: @mid is hung where the spine of the taller tree reaches the
+ * height of the shorter one, then the path above it is rebalanced.
+ * O(|height(lo) - height(hi)| + 1) rotations and updates.
+ *
+ * Return: Pointer to the root node of the joined tree
+ */
+avl_t *avl_join3(avl_t *lo, avl_t *mid, avl_t *hi)
+{
+    avl_t *parent = NULL, *node;
+    int h_lo = BT_HEIGHT(lo), h_hi = BT_HEIGHT(hi);
+
+    if (h_lo > h_hi + 1)
+    {
+        for (node = lo; BT_HEIGHT(node) > h_hi + 1; node = node->right)
+            parent = node;
+        lo = node;
+    }
+    else if (h_hi > h_lo + 1)
+    {
+        for (node = hi; BT_HEIGHT(node) > h_lo + 1; node = node->left)
+            parent = node;
+        hi = node;
+    }
+
+    mid->left = lo;
+    mid->right = hi;
+    if (lo != NULL)
+        lo->parent = mid;
+    if (hi != NULL)
+        hi->parent = mid;
+    mid->parent = parent;
+    BT_UPDATE(mid);
+    if (parent == NULL)
+        return (mid);
+
+    if (h_lo > h_hi)
+        parent->right = mid;
+    else
+        parent->left = mid;
+
+    return (avl_retrace(parent));
+}
+
+/**
+ * avl_join2 - Joins two AVL trees
+ * @lo: Root of an AVL tree whose keys are all lower than @hi's, or NULL
+ * @hi: Root of an AVL tree, or NULL
+ *
+ * Description: the highest node of @lo is unlinked and used as the middle
+ * node of avl_join3, in O(log n).
+ *
+ * Return: Pointer to the root node of the joined tree
+ */
+avl_t *avl_join2(avl_t *lo, avl_t *hi)
+{
+    avl_t *last, *parent;
+
+    if (lo == NULL)
+        return (hi);
+    if (hi == NULL)
+        return (lo);
+
+    for (last = lo; last->right != NULL; last = last->right)
+        ;
+    parent = last->parent;
+    if (last->left != NULL)
+        last->left->parent = parent;
+    if (parent == NULL)
+        lo = last->left;
+    else
+    {
+        parent->right = last->left;
+        lo = avl_retrace(parent);
+    }
+
+    return (avl_join3(lo, last, hi));
+}
+
+/**
+ * avl_split3 - Splits an AVL tree around a key
+ * @tree: Root of the AVL tree, consumed
+ * @key: Key to split around
+ * @lo: Receives the AVL tree of the keys lower than @key
+ * @hi: Receives the AVL tree of the keys higher than @key
+ *
+ * Description: the subtrees hanging off the search path are joined back
+ * on each side with avl_join3, in O(log n) overall.
+ *
+ * Return: The detached node holding @key, or NULL if it is absent
+ */
+avl_t *avl_split3(avl_t *tree, int key, avl_t **lo, avl_t **hi)
+{
+    avl_t *left, *right, *mid, *found;
+
+    if (tree == NULL)
+    {
+        *lo = NULL;
+        *hi = NULL;
+        return (NULL);
+    }
+
+    left = tree->left;
+    right = tree->right;
+    if (left != NULL)
+        left->parent = NULL;
+    if (right != NULL)
+        right->parent = NULL;
+    tree->parent = NULL;
+    tree->left = NULL;
+    tree->right = NULL;
+
+    if (key < tree->n)
+    {
+        found = avl_split3(left, key, lo, &mid);
+        *hi = avl_join3(mid, tree, right);
+        return (found);
+    }
+    if (key > tree->n)
+    {
+        found = avl_split3(right, key, &mid, hi);
+        *lo = avl_join3(left, tree, mid);
+        return (found);
+    }
+
+    *lo = left;
+    *hi = right;
+    BT_UPDATE(tree);
+
+    return (tree);
+}
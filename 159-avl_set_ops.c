@@ -0,0 +1,145 @@
+#include <pthread.h>
+#include "binary_trees.h"
+
+/* Operations of avl_set_op */
+#define AVL_UNION 0
+#define AVL_INTERSECTION 1
+#define AVL_DIFFERENCE 2
+
+/**
+ * struct avl_set_task_s - Half of a set operation run by another thread
+ *
+ * @op: AVL_UNION, AVL_INTERSECTION or AVL_DIFFERENCE
+ * @a: First operand
+ * @b: Second operand
+ * @depth: Recursion depth of the half
+ * @result: Root of the resulting tree
+ */
+typedef struct avl_set_task_s
+{
+    int op;
+    avl_t *a;
+    avl_t *b;
+    int depth;
+    avl_t *result;
+} avl_set_task_t;
+
+static avl_t *avl_set_op(int op, avl_t *a, avl_t *b, int depth);
+
+/**
+ * avl_set_worker - Thread entry running one half of a set operation
+ * @arg: Pointer to the avl_set_task_t
+ *
+ * Return: NULL
+ */
+static void *avl_set_worker(void *arg)
+{
+    avl_set_task_t *task = arg;
+
+    task->result = avl_set_op(task->op, task->a, task->b, task->depth);
+    return (NULL);
+}
+
+/**
+ * avl_set_op - Join-based set operation on two AVL trees
+ * @op: AVL_UNION, AVL_INTERSECTION or AVL_DIFFERENCE
+ * @a: First operand, consumed
+ * @b: Second operand, consumed
+ * @depth: Recursion depth, threads are only started near the top
+ *
+ * Description: @a is split around the root of @b, the operation recurses
+ * on both sides, and the results are joined back with or without that
+ * root. O(m log(n / m + 1)) work for sizes m <= n. While @b is taller than
+ * AVL_SET_PAR_HEIGHT and fewer than AVL_SET_PAR_DEPTH levels are split,
+ * the lower half runs in a new thread; if no thread can be started it
+ * runs inline.
+ *
+ * Return: Root of the resulting tree
+ */
+static avl_t *avl_set_op(int op, avl_t *a, avl_t *b, int depth)
+{
+    avl_set_task_t task;
+    pthread_t thread;
+    avl_t *found, *b_hi, *hi;
+    int spawned = 0;
+
+    if (a == NULL || b == NULL)
+    {
+        if (op == AVL_UNION)
+            return (a != NULL ? a : b);
+        binary_tree_delete(b);
+        if (op == AVL_INTERSECTION)
+        {
+            binary_tree_delete(a);
+            return (NULL);
+        }
+        return (a);
+    }
+
+    task.op = op;
+    task.b = b->left;
+    task.depth = depth + 1;
+    b_hi = b->right;
+    if (task.b != NULL)
+        task.b->parent = NULL;
+    if (b_hi != NULL)
+        b_hi->parent = NULL;
+    found = avl_split3(a, b->n, &task.a, &a);
+
+    if (depth < AVL_SET_PAR_DEPTH && b->height > AVL_SET_PAR_HEIGHT)
+        spawned = pthread_create(&thread, NULL, avl_set_worker, &task) == 0;
+    if (!spawned)
+        avl_set_worker(&task);
+    hi = avl_set_op(op, a, b_hi, depth + 1);
+    if (spawned)
+        pthread_join(thread, NULL);
+
+    if (op == AVL_UNION || (op == AVL_INTERSECTION && found != NULL))
+    {
+        binary_tree_node_free(found);
+        return (avl_join3(task.result, b, hi));
+    }
+    binary_tree_node_free(found);
+    binary_tree_node_free(b);
+
+    return (avl_join2(task.result, hi));
+}
+
+/**
+ * avl_union - Computes the union of two AVL trees
+ * @a: Root of the first tree, consumed
+ * @b: Root of the second tree, consumed
+ *
+ * Return: Root of the AVL tree holding the keys of @a or @b; the nodes are
+ * reused and duplicates freed
+ */
+avl_t *avl_union(avl_t *a, avl_t *b)
+{
+    return (avl_set_op(AVL_UNION, a, b, 0));
+}
+
+/**
+ * avl_intersection - Computes the intersection of two AVL trees
+ * @a: Root of the first tree, consumed
+ * @b: Root of the second tree, consumed
+ *
+ * Return: Root of the AVL tree holding the keys of both @a and @b; the
+ * nodes are reused and the others freed
+ */
+avl_t *avl_intersection(avl_t *a, avl_t *b)
+{
+    return (avl_set_op(AVL_INTERSECTION, a, b, 0));
+}
+
+/**
+ * avl_difference - Computes the difference of two AVL trees
+ * @a: Root of the first tree, consumed
+ * @b: Root of the second tree, consumed
+ *
+ * Return: Root of the AVL tree holding the keys of @a absent from @b; the
+ * nodes are reused and the others freed
+ */
+avl_t *avl_difference(avl_t *a, avl_t *b)
+{
+    return (avl_set_op(AVL_DIFFERENCE, a, b, 0));
+}
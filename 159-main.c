@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 100000
+
+/**
+ * build - Builds an AVL tree of the multiples of a step
+ * @step: Distance between two keys
+ *
+ * Return: Root of the tree, NULL on failure
+ */
+static avl_t *build(int step)
+{
+    avl_t *tree = NULL;
+    int i;
+
+    for (i = 0; i < NB_KEYS; i += step)
+    {
+        if (avl_insert(&tree, i) == NULL)
+        {
+            binary_tree_delete(tree);
+            return (NULL);
+        }
+    }
+    return (tree);
+}
+
+/**
+ * main - Entry point, build with -pthread
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree;
+
+    tree = build(2);
+    printf("Multiples of 2: %lu keys, height %d\n",
+           (unsigned long)binary_tree_size(tree), BT_HEIGHT(tree));
+
+    tree = avl_union(tree, build(3));
+    printf("Union with multiples of 3: %lu keys, height %d, is BST: %d\n",
+           (unsigned long)binary_tree_size(tree), BT_HEIGHT(tree),
+           binary_tree_is_bst(tree));
+
+    tree = avl_intersection(tree, build(5));
+    printf("Intersection with multiples of 5: %lu keys, height %d\n",
+           (unsigned long)binary_tree_size(tree), BT_HEIGHT(tree));
+
+    tree = avl_difference(tree, build(4));
+    printf("Difference with multiples of 4: %lu keys, height %d\n",
+           (unsigned long)binary_tree_size(tree), BT_HEIGHT(tree));
+
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,45 @@
+#include "binary_trees.h"
+
+/**
+ * avl_split - Splits an AVL tree in two around a key
+ * @tree: Root of the AVL tree, consumed
+ * @key: First key of the upper tree
+ * @lo: Receives the AVL tree of the keys lower than @key
+ * @hi: Receives the AVL tree of the keys greater than or equal to @key
+ *
+ * Description: no node is allocated or freed; only the nodes on the
+ * search path are relinked and rebalanced, in O(log n).
+ */
+void avl_split(avl_t *tree, int key, avl_t **lo, avl_t **hi)
+{
+    avl_t *found, *low, *high;
+
+    found = avl_split3(tree, key, &low, &high);
+    if (found != NULL)
+        high = avl_join3(NULL, found, high);
+
+    if (lo != NULL)
+        *lo = low;
+    else
+        binary_tree_delete(low);
+    if (hi != NULL)
+        *hi = high;
+    else
+        binary_tree_delete(high);
+}
+
+/**
+ * avl_join - Concatenates two AVL trees
+ * @lo: Root of an AVL tree, consumed
+ * @hi: Root of an AVL tree whose keys are all greater than those of @lo,
+ *      consumed
+ *
+ * Description: the nodes are reused; only the path where the shorter
+ * tree is hung is rebalanced, in O(log n).
+ *
+ * Return: Root of the joined AVL tree
+ */
+avl_t *avl_join(avl_t *lo, avl_t *hi)
+{
+    return (avl_join2(lo, hi));
+}
@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 100000
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *shard_a = NULL, *shard_b = NULL, *range, *rest;
+    int i;
+
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        if (avl_insert(i < NB_KEYS / 2 ? &shard_a : &shard_b, i) == NULL)
+            return (1);
+    }
+    printf("Shard A: %lu keys, shard B: %lu keys\n",
+           (unsigned long)binary_tree_size(shard_a),
+           (unsigned long)binary_tree_size(shard_b));
+
+    /* Move [40000, 50000) from A to the front of B */
+    avl_split(shard_a, 40000, &shard_a, &range);
+    shard_b = avl_join(range, shard_b);
+    printf("Moved [40000, 50000): A has %lu keys, height %d, "
+           "B has %lu keys, height %d\n",
+           (unsigned long)binary_tree_size(shard_a), BT_HEIGHT(shard_a),
+           (unsigned long)binary_tree_size(shard_b), BT_HEIGHT(shard_b));
+
+    /* Move [60000, 70000) from B to the back of A */
+    avl_split(shard_b, 60000, &rest, &shard_b);
+    avl_split(shard_b, 70000, &range, &shard_b);
+    shard_b = avl_join(rest, shard_b);
+    shard_a = avl_join(shard_a, range);
+    printf("Moved [60000, 70000) back: A has %lu keys, B has %lu keys, "
+           "both BST: %d\n", (unsigned long)binary_tree_size(shard_a),
+           (unsigned long)binary_tree_size(shard_b),
+           binary_tree_is_bst(shard_a) && binary_tree_is_bst(shard_b));
+
+    binary_tree_delete(shard_a);
+    binary_tree_delete(shard_b);
+    return (0);
+}
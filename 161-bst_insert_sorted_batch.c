@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+/**
+ * batch_build - Builds a balanced BST from a sorted run of keys
+ * @parent: Parent of the subtree
+ * @keys: Sorted keys, duplicates allowed
+ * @n: Number of keys
+ * @count: Incremented for every node created, left unchanged on failure
+ * @failed: Set to 1 when an allocation fails, stops further allocations
+ *
+ * Return: Root of the subtree, NULL if empty or on failure
+ */
+static bst_t *batch_build(bst_t *parent, const int *keys, size_t n,
+                          size_t *count, int *failed)
+{
+    bst_t *node;
+    size_t mid, next;
+
+    if (n == 0 || *failed)
+        return (NULL);
+
+    mid = n / 2;
+    while (mid > 0 && keys[mid - 1] == keys[mid])
+        mid--;
+    for (next = mid + 1; next < n && keys[next] == keys[mid]; next++)
+        ;
+
+    node = binary_tree_node(parent, keys[mid]);
+    if (node == NULL)
+    {
+        *failed = 1;
+        return (NULL);
+    }
+    (*count)++;
+    node->left = batch_build(node, keys, mid, count, failed);
+    node->right = batch_build(node, keys + next, n - next, count, failed);
+    BT_UPDATE(node);
+
+    return (node);
+}
+
+/**
+ * batch_descend - Inserts a sorted run of keys below a link of a BST
+ * @link: Link to the subtree receiving the keys
+ * @parent: Node owning @link, NULL for the root
+ * @keys: Sorted keys, all within the range of @link
+ * @n: Number of keys
+ * @failed: Set to 1 when an allocation fails
+ *
+ * Description: the run is cut around each visited node with a binary
+ * search, so every node is visited at most once for the whole batch and
+ * runs falling into an empty link are hung as balanced subtrees.
+ *
+ * Return: Number of nodes created
+ */
+static size_t batch_descend(bst_t **link, bst_t *parent, const int *keys,
+                            size_t n, int *failed)
+{
+    bst_t *node = *link;
+    size_t lo = 0, hi = n, mid, next, count = 0;
+
+    if (n == 0)
+        return (0);
+    if (node == NULL)
+    {
+        *link = batch_build(parent, keys, n, &count, failed);
+        return (count);
+    }
+
+    BT_STAT_ADD(visits, 1);
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        BT_STAT_ADD(comparisons, 1);
+        if (keys[mid] < node->n)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    for (next = lo; next < n && keys[next] == node->n; next++)
+        ;
+
+    count = batch_descend(&node->left, node, keys, lo, failed);
+    count += batch_descend(&node->right, node, keys + next, n - next, failed);
+    if (count != 0)
+        BT_UPDATE(node);
+
+    return (count);
+}
+
+/**
+ * batch_rebuild - Merges a sorted run of keys with a BST and rebuilds it
+ * @tree: Double pointer to the root node of the BST
+ * @keys: Sorted keys
+ * @n: Number of keys
+ * @size: Number of nodes in the tree
+ * @failed: Set to 1 when an allocation fails
+ *
+ * Description: the existing nodes are reused; the result is balanced.
+ *
+ * Return: Number of nodes created
+ */
+static size_t batch_rebuild(bst_t **tree, const int *keys, size_t n,
+                            size_t size, int *failed)
+{
+    bst_t **old, **merged, *node;
+    size_t i, j = 0, k = 0, count = 0;
+
+    old = malloc((size + 1) * sizeof(*old));
+    merged = malloc((size + n) * sizeof(*merged));
+    if (old == NULL || merged == NULL)
+    {
+        free(old);
+        free(merged);
+        return (batch_descend(tree, NULL, keys, n, failed));
+    }
+    bst_flatten(*tree, old);
+
+    for (i = 0; i < size || j < n;)
+    {
+        if (j < n && (*failed || (j > 0 && keys[j] == keys[j - 1]) ||
+                      (i < size && keys[j] == old[i]->n)))
+            j++;
+        else if (j == n || (i < size && old[i]->n < keys[j]))
+            merged[k++] = old[i++];
+        else
+        {
+            node = binary_tree_node(NULL, keys[j++]);
+            if (node == NULL)
+                *failed = 1;
+            else
+            {
+                merged[k++] = node;
+                count++;
+            }
+        }
+    }
+    *tree = bst_build_balanced(merged, k);
+    free(old);
+    free(merged);
+
+    return (count);
+}
+
+/**
+ * bst_size_upto - Counts the nodes of a BST, stopping past a limit
+ * @tree: Root of the tree
+ * @limit: Count at which to stop
+ *
+ * Return: Number of nodes, or a value above @limit
+ */
+static size_t bst_size_upto(const bst_t *tree, size_t limit)
+{
+    size_t size = 0;
+
+#ifdef BT_ORDER_STATS
+    (void)limit;
+    size = BT_SIZE(tree);
+#else
+    for (; tree != NULL && size <= limit; tree = tree->right)
+        size += 1 + bst_size_upto(tree->left, limit - size);
+#endif
+
+    return (size);
+}
+
+/**
+ * bst_insert_sorted_batch - Inserts a sorted batch of keys in a BST
+ * @tree: Double pointer to the root node of the BST
+ * @keys: Keys in ascending order, duplicates are skipped
+ * @n: Number of keys
+ *
+ * Description: when the tree holds fewer nodes than the batch, the tree
+ * and the batch are merged and the tree is rebuilt balanced, reusing its
+ * nodes. Otherwise the batch descends the tree once, split by binary
+ * search at each node, and the runs reaching an empty link are hung as
+ * balanced subtrees. Unsorted input falls back to bst_insert per key.
+ *
+ * Return: Number of keys inserted; on allocation failure the tree stays a
+ * valid BST holding the keys inserted so far
+ */
+size_t bst_insert_sorted_batch(bst_t **tree, const int *keys, size_t n)
+{
+    size_t i, size, count = 0;
+    int failed = 0;
+
+    if (tree == NULL || keys == NULL)
+        return (0);
+
+    for (i = 1; i < n; i++)
+    {
+        if (keys[i] < keys[i - 1])
+        {
+            for (i = 0; i < n; i++)
+                count += bst_insert(tree, keys[i]) != NULL;
+            return (count);
+        }
+    }
+
+    size = bst_size_upto(*tree, n);
+    if (size <= n)
+        return (batch_rebuild(tree, keys, n, size, &failed));
+
+    return (batch_descend(tree, NULL, keys, n, &failed));
+}
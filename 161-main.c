@@ -0,0 +1,80 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+#define NB_BATCHES 10
+#define BATCH 100000
+
+/**
+ * elapsed - Seconds since a given time
+ * @t0: Start time
+ *
+ * Return: Elapsed seconds
+ */
+static double elapsed(const struct timespec *t0)
+{
+    struct timespec t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return ((t1.tv_sec - t0->tv_sec) + (t1.tv_nsec - t0->tv_nsec) / 1e9);
+}
+
+/**
+ * main - Entry point, link with 161-bst_insert_sorted_batch.c and
+ *        162-bst_rebuild.c
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *batched = NULL, *single = NULL;
+    struct timespec t0;
+    double t_batch = 0, t_single = 0;
+    unsigned long x = 88172645463325252UL;
+    int *keys;
+    size_t b, i, inserted = 0;
+
+    keys = malloc(BATCH * sizeof(int));
+    if (keys == NULL)
+        return (1);
+
+    /* Same random starting tree for both, keys are multiples of 4 */
+    for (i = 0; i < BATCH; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        bst_insert(&batched, (int)(x % 100000000) * 4);
+        bst_insert(&single, (int)(x % 100000000) * 4);
+    }
+
+    for (b = 0; b < NB_BATCHES; b++)
+    {
+        /* Sorted run of keys not yet in the tree, spread over its range */
+        for (i = 0; i < BATCH; i++)
+            keys[i] = (int)(i * 4000 + b * 400 + 1 + b % 3);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        inserted += bst_insert_sorted_batch(&batched, keys, BATCH);
+        t_batch += elapsed(&t0);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (i = 0; i < BATCH; i++)
+            bst_insert(&single, keys[i]);
+        t_single += elapsed(&t0);
+    }
+
+    printf("%d sorted batches of %d keys, %lu inserted\n", NB_BATCHES, BATCH,
+           (unsigned long)inserted);
+    printf("bst_insert_sorted_batch: %.3f s, height %lu, is BST: %d\n",
+           t_batch, (unsigned long)binary_tree_height(batched),
+           binary_tree_is_bst(batched));
+    printf("bst_insert per key: %.3f s, height %lu\n", t_single,
+           (unsigned long)binary_tree_height(single));
+
+    binary_tree_delete(batched);
+    binary_tree_delete(single);
+    free(keys);
+    return (0);
+}
@@ -0,0 +1,215 @@
+#include "binary_trees.h"
+
+#ifndef BT_TOMBSTONE
+#error "162-bst_lazy.c needs the deleted flag, build with -DBT_TOMBSTONE"
+#endif
+
+/**
+ * bst_lazy_init - Prepares an empty lazily-deleting BST
+ * @tree: Pointer to the handle
+ */
+void bst_lazy_init(bst_lazy_t *tree)
+{
+    tree->root = NULL;
+    tree->live = 0;
+    tree->dead = 0;
+    tree->ratio = BST_LAZY_RATIO;
+}
+
+/**
+ * lazy_insert_at - Inserts or revives a value below a node
+ * @tree: Double pointer to the link to descend from
+ * @parent: Node owning that link, NULL for the root
+ * @value: Value to insert
+ * @state: Set to 1 when a node is created, 2 when a tombstone is revived
+ *
+ * Return: Pointer to the node holding the value, or NULL on failure or if
+ * the value is already present
+ */
+static bst_t *lazy_insert_at(bst_t **tree, bst_t *parent, int value,
+                             int *state)
+{
+    bst_t *node;
+
+    if (*tree == NULL)
+    {
+        *tree = binary_tree_node(parent, value);
+        if (*tree != NULL)
+            *state = 1;
+        return (*tree);
+    }
+
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
+    if (value < (*tree)->n)
+        node = lazy_insert_at(&(*tree)->left, *tree, value, state);
+    else if (BT_STAT_ADD(comparisons, 1), value > (*tree)->n)
+        node = lazy_insert_at(&(*tree)->right, *tree, value, state);
+    else
+    {
+        if (!(*tree)->deleted)
+            return (NULL);
+        (*tree)->deleted = 0;
+        *state = 2;
+        node = *tree;
+    }
+
+    /* The flag is hashed with BT_MERKLE, so refresh the path either way */
+    if (*state != 0)
+        BT_UPDATE(*tree);
+    return (node);
+}
+
+/**
+ * bst_lazy_insert - Inserts a value in a lazily-deleting BST
+ * @tree: Pointer to the handle
+ * @value: Value to insert
+ *
+ * Description: a single descent either hangs a new node or revives the
+ * tombstone holding @value in place, without allocation or structural
+ * change.
+ *
+ * Return: Pointer to the node holding the value, or NULL on failure or if
+ * the value is already present
+ */
+bst_t *bst_lazy_insert(bst_lazy_t *tree, int value)
+{
+    bst_t *node;
+    int state = 0;
+
+    if (tree == NULL)
+        return (NULL);
+
+    node = lazy_insert_at(&tree->root, NULL, value, &state);
+    if (node == NULL)
+        return (NULL);
+    if (state == 2)
+        tree->dead--;
+    tree->live++;
+
+    return (node);
+}
+
+/**
+ * bst_lazy_search - Searches a value in a lazily-deleting BST
+ * @tree: Pointer to the handle
+ * @value: Value to search
+ *
+ * Return: Pointer to the node holding the value, or NULL if it is absent
+ * or was removed
+ */
+bst_t *bst_lazy_search(const bst_lazy_t *tree, int value)
+{
+    bst_t *node;
+
+    if (tree == NULL)
+        return (NULL);
+
+    node = bst_search(tree->root, value);
+    if (node == NULL || node->deleted)
+        return (NULL);
+
+    return (node);
+}
+
+/**
+ * lazy_mark - Marks the node holding a value as deleted
+ * @tree: Root of the subtree
+ * @value: Value to remove
+ *
+ * Description: refreshes the nodes on the way back up, since the flag is
+ * part of the hash with BT_MERKLE.
+ *
+ * Return: 1 if a live node was marked, 0 otherwise
+ */
+static int lazy_mark(bst_t *tree, int value)
+{
+    int marked;
+
+    if (tree == NULL)
+        return (0);
+
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
+    if (value < tree->n)
+        marked = lazy_mark(tree->left, value);
+    else if (BT_STAT_ADD(comparisons, 1), value > tree->n)
+        marked = lazy_mark(tree->right, value);
+    else
+    {
+        marked = !tree->deleted;
+        tree->deleted = 1;
+    }
+
+    if (marked)
+        BT_UPDATE(tree);
+    return (marked);
+}
+
+/**
+ * bst_lazy_remove - Removes a value from a lazily-deleting BST
+ * @tree: Pointer to the handle
+ * @value: Value to remove
+ *
+ * Description: the node is only marked, in O(h) and without touching any
+ * link, so the shape seen by readers does not change. Once tombstones make
+ * up tree->ratio percent of the nodes, bst_lazy_compact runs.
+ *
+ * Return: 1 if the value was removed, 0 if it was not present
+ */
+int bst_lazy_remove(bst_lazy_t *tree, int value)
+{
+    if (tree == NULL || !lazy_mark(tree->root, value))
+        return (0);
+
+    tree->live--;
+    tree->dead++;
+    if (tree->ratio != 0 &&
+        tree->dead * 100 >= (tree->live + tree->dead) * tree->ratio)
+        bst_lazy_compact(tree);
+
+    return (1);
+}
+
+/**
+ * bst_lazy_visit - Calls a function on the live values of a subtree
+ * @tree: Root of the subtree
+ * @func: Function to call, in ascending order of value
+ */
+static void bst_lazy_visit(const bst_t *tree, void (*func)(int))
+{
+    for (; tree != NULL; tree = tree->right)
+    {
+        bst_lazy_visit(tree->left, func);
+        if (!tree->deleted)
+            func(tree->n);
+    }
+}
+
+/**
+ * bst_lazy_inorder - Goes through the live values of a lazily-deleting BST
+ * @tree: Pointer to the handle
+ * @func: Function to call for each value, in ascending order
+ */
+void bst_lazy_inorder(const bst_lazy_t *tree, void (*func)(int))
+{
+    if (tree == NULL || func == NULL)
+        return;
+
+    bst_lazy_visit(tree->root, func);
+}
+
+/**
+ * bst_lazy_delete - Frees a lazily-deleting BST
+ * @tree: Pointer to the handle, left empty
+ */
+void bst_lazy_delete(bst_lazy_t *tree)
+{
+    if (tree == NULL)
+        return;
+
+    binary_tree_delete(tree->root);
+    tree->root = NULL;
+    tree->live = 0;
+    tree->dead = 0;
+}
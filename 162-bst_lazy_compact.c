@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+#ifndef BT_TOMBSTONE
+#error "162-bst_lazy_compact.c needs the deleted flag, build with -DBT_TOMBSTONE"
+#endif
+
+/**
+ * bst_lazy_compact - Frees the tombstones of a lazily-deleting BST
+ * @tree: Pointer to the handle
+ *
+ * Description: the live nodes are collected in order and relinked into a
+ * balanced tree, in O(n); the tombstones are freed. Callers that want the
+ * cost out of the remove path set tree->ratio to 0 and call this when idle.
+ *
+ * Return: 1 on success, 0 on allocation failure (the tree is unchanged)
+ */
+int bst_lazy_compact(bst_lazy_t *tree)
+{
+    bst_t **nodes;
+    size_t i, n, live = 0;
+
+    if (tree == NULL)
+        return (0);
+    if (tree->dead == 0)
+        return (1);
+
+    nodes = malloc((tree->live + tree->dead) * sizeof(*nodes));
+    if (nodes == NULL)
+        return (0);
+
+    n = bst_flatten(tree->root, nodes);
+    for (i = 0; i < n; i++)
+    {
+        if (nodes[i]->deleted)
+            binary_tree_node_free(nodes[i]);
+        else
+            nodes[live++] = nodes[i];
+    }
+    tree->root = bst_build_balanced(nodes, live);
+    tree->dead = 0;
+    free(nodes);
+
+    return (1);
+}
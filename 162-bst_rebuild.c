@@ -0,0 +1,60 @@
+#include "binary_trees.h"
+
+/**
+ * bst_flatten - Stores the nodes of a tree in order
+ * @tree: Root of the tree
+ * @nodes: Array receiving the nodes, large enough for the whole tree
+ *
+ * Return: Number of nodes stored
+ */
+size_t bst_flatten(bst_t *tree, bst_t **nodes)
+{
+    size_t i = 0;
+
+    for (; tree != NULL; tree = tree->right)
+    {
+        i += bst_flatten(tree->left, nodes + i);
+        nodes[i++] = tree;
+    }
+
+    return (i);
+}
+
+/**
+ * bst_link - Links sorted nodes into a perfectly balanced subtree
+ * @parent: Parent of the subtree
+ * @nodes: Sorted nodes
+ * @n: Number of nodes
+ *
+ * Return: Root of the subtree
+ */
+static bst_t *bst_link(bst_t *parent, bst_t **nodes, size_t n)
+{
+    bst_t *node;
+
+    if (n == 0)
+        return (NULL);
+
+    node = nodes[n / 2];
+    BT_SET_PARENT(node, parent);
+    node->left = bst_link(node, nodes, n / 2);
+    node->right = bst_link(node, nodes + n / 2 + 1, n - n / 2 - 1);
+    BT_UPDATE(node);
+
+    return (node);
+}
+
+/**
+ * bst_build_balanced - Relinks sorted nodes into a balanced BST
+ * @nodes: Nodes in ascending order of value, e.g. from bst_flatten
+ * @n: Number of nodes
+ *
+ * Description: no node is allocated; heights, and sizes or hashes when
+ * enabled, are recomputed. The result has minimal height.
+ *
+ * Return: Root of the tree, NULL if @n is 0
+ */
+bst_t *bst_build_balanced(bst_t **nodes, size_t n)
+{
+    return (bst_link(NULL, nodes, n));
+}
@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 100000
+
+static long sum;
+
+/**
+ * add - Adds a value to the running sum
+ * @n: Value
+ */
+static void add(int n)
+{
+    sum += n;
+}
+
+/**
+ * main - Entry point, build with -DBT_TOMBSTONE
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_lazy_t tree;
+    int i;
+
+    bst_lazy_init(&tree);
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        if (bst_lazy_insert(&tree, (i * 7919) % NB_KEYS) == NULL)
+            return (1);
+    }
+    printf("Inserted %lu values, height %d\n", (unsigned long)tree.live,
+           BT_HEIGHT(tree.root));
+
+    tree.ratio = 0;
+    for (i = 0; i < NB_KEYS; i += 2)
+        bst_lazy_remove(&tree, i);
+    printf("Removed even values: %lu live, %lu tombstones, search 2: %p\n",
+           (unsigned long)tree.live, (unsigned long)tree.dead,
+           (void *)bst_lazy_search(&tree, 2));
+
+    bst_lazy_insert(&tree, 2);
+    printf("Reinserted 2 in place: %lu tombstones\n",
+           (unsigned long)tree.dead);
+
+    bst_lazy_inorder(&tree, add);
+    printf("Sum of live values: %ld\n", sum);
+
+    bst_lazy_compact(&tree);
+    printf("Compacted: %lu nodes, height %d\n",
+           (unsigned long)binary_tree_size(tree.root), BT_HEIGHT(tree.root));
+
+    tree.ratio = BST_LAZY_RATIO;
+    for (i = 1; i < NB_KEYS; i += 4)
+        bst_lazy_remove(&tree, i);
+    printf("With automatic compaction: %lu live, %lu tombstones\n",
+           (unsigned long)tree.live, (unsigned long)tree.dead);
+
+    bst_lazy_delete(&tree);
+    return (0);
+}
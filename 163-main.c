@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+#define NB_KEYS 1000000
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    sg_tree_t tree = {NULL, 0, 0};
+    int i;
+
+    for (i = 0; i < NB_KEYS; i++)
+    {
+        if (sg_tree_insert(&tree, i) == NULL)
+            return (1);
+    }
+    printf("Sorted insert of %d keys: height %lu, is BST: %d\n", NB_KEYS,
+           (unsigned long)binary_tree_height(tree.root),
+           binary_tree_is_bst(tree.root));
+
+    for (i = 0; i < NB_KEYS; i += 3)
+        sg_tree_remove(&tree, i);
+    printf("After removing a third: %lu keys, height %lu\n",
+           (unsigned long)tree.size,
+           (unsigned long)binary_tree_height(tree.root));
+    printf("Search 3: %p, search 4: %d\n", (void *)bst_search(tree.root, 3),
+           bst_search(tree.root, 4)->n);
+
+    sg_tree_delete(&tree);
+    return (0);
+}
@@ -0,0 +1,222 @@
+#include <stdlib.h>
+#include "binary_trees.h"
+
+#ifdef BT_NO_PARENT
+#error "the scapegoat tree walks parent links, drop BT_NO_PARENT"
+#endif
+
+/**
+ * sg_depth_limit - Computes the deepest depth allowed in a scapegoat tree
+ * @size: Number of nodes
+ *
+ * Return: floor(log_{1/alpha}(size)), computed without floating point
+ */
+static size_t sg_depth_limit(size_t size)
+{
+    size_t depth = 0, weight = 1, next;
+
+    /* weight runs over ceil((1 / alpha)^depth) */
+    while ((next = (weight * SG_ALPHA_DEN + SG_ALPHA_NUM - 1) / SG_ALPHA_NUM)
+           <= size)
+    {
+        weight = next;
+        depth++;
+    }
+
+    return (depth);
+}
+
+/**
+ * sg_rebuild - Rebuilds a subtree into perfect balance in place
+ * @tree: Pointer to the scapegoat tree
+ * @node: Root of the subtree
+ * @size: Number of nodes in the subtree
+ *
+ * Description: the nodes are reused and only relinked, in O(size). If
+ * the temporary array cannot be allocated the subtree is left as is.
+ *
+ * Return: Root of the rebuilt subtree, or NULL if it was left as is
+ */
+static bst_t *sg_rebuild(sg_tree_t *tree, bst_t *node, size_t size)
+{
+    bst_t **nodes, *parent = node->parent, *sub;
+
+    nodes = malloc(size * sizeof(*nodes));
+    if (nodes == NULL)
+        return (NULL);
+
+    bst_flatten(node, nodes);
+    sub = bst_build_balanced(nodes, size);
+    free(nodes);
+    sub->parent = parent;
+    if (parent == NULL)
+        tree->root = sub;
+    else if (parent->left == node)
+        parent->left = sub;
+    else
+        parent->right = sub;
+
+    return (sub);
+}
+
+/**
+ * sg_tree_insert - Inserts a value in a scapegoat tree
+ * @tree: Pointer to the scapegoat tree
+ * @value: Value to insert
+ *
+ * Description: when the new leaf is deeper than sg_depth_limit, the
+ * ancestors are walked up, summing subtree sizes, until one holds a child
+ * heavier than alpha times itself; that scapegoat's subtree is rebuilt.
+ * Amortized O(log n).
+ *
+ * Return: Pointer to the created node, or NULL on failure or duplicate
+ */
+bst_t *sg_tree_insert(sg_tree_t *tree, int value)
+{
+    bst_t *parent = NULL, **link, *new_node, *node, *up, *sub;
+    size_t depth = 0, size, total;
+
+    if (tree == NULL)
+        return (NULL);
+
+    link = &tree->root;
+    while (*link != NULL)
+    {
+        parent = *link;
+        BT_STAT_ADD(visits, 1);
+        BT_STAT_ADD(comparisons, 1);
+        if (value < parent->n)
+            link = &parent->left;
+        else if (BT_STAT_ADD(comparisons, 1), value > parent->n)
+            link = &parent->right;
+        else
+            return (NULL);
+        depth++;
+    }
+
+    new_node = binary_tree_node(parent, value);
+    if (new_node == NULL)
+        return (NULL);
+    *link = new_node;
+    BT_STAT_DEPTH(depth + 1);
+    tree->size++;
+    if (tree->size > tree->max_size)
+        tree->max_size = tree->size;
+
+    up = parent;
+    if (depth > sg_depth_limit(tree->size))
+    {
+        for (node = new_node, size = 1; node->parent != NULL;
+             node = node->parent, size = total)
+        {
+            parent = node->parent;
+            total = size + 1 + BT_SIZE(parent->left == node ?
+                                       parent->right : parent->left);
+            if (size * SG_ALPHA_DEN > total * SG_ALPHA_NUM)
+            {
+                /* Without a rebuild the whole path still needs updating */
+                sub = sg_rebuild(tree, parent, total);
+                if (sub != NULL)
+                    up = sub->parent;
+                break;
+            }
+        }
+    }
+    for (; up != NULL; up = up->parent)
+        BT_UPDATE(up);
+
+    return (new_node);
+}
+
+/**
+ * sg_unlink - Removes the node at a link of a scapegoat tree
+ * @link: Link holding the node
+ *
+ * Description: a node with two children takes the value of its in-order
+ * successor, which is unlinked instead.
+ *
+ * Return: Parent of the freed node, the first node to update
+ */
+static bst_t *sg_unlink(bst_t **link)
+{
+    bst_t *node = *link, *next, *parent;
+
+    if (node->left != NULL && node->right != NULL)
+    {
+        link = &node->right;
+        while ((*link)->left != NULL)
+        {
+            BT_STAT_ADD(visits, 1);
+            link = &(*link)->left;
+        }
+        node->n = (*link)->n;
+#ifdef BT_MULTISET
+        node->count = (*link)->count;
+#endif
+        node = *link;
+    }
+
+    next = node->left != NULL ? node->left : node->right;
+    parent = node->parent;
+    *link = next;
+    if (next != NULL)
+        next->parent = parent;
+    binary_tree_node_free(node);
+
+    return (parent);
+}
+
+/**
+ * sg_tree_remove - Removes a value from a scapegoat tree
+ * @tree: Pointer to the scapegoat tree
+ * @value: Value to remove
+ *
+ * Description: a single descent finds and unlinks the node, then the
+ * whole tree is rebuilt once it has shrunk below alpha times its largest
+ * size. Amortized O(log n).
+ *
+ * Return: 1 if the value was removed, 0 if it was not present
+ */
+int sg_tree_remove(sg_tree_t *tree, int value)
+{
+    bst_t **link, *up;
+
+    if (tree == NULL)
+        return (0);
+
+    link = &tree->root;
+    while (*link != NULL && (*link)->n != value)
+    {
+        BT_STAT_ADD(visits, 1);
+        BT_STAT_ADD(comparisons, 2);
+        link = value < (*link)->n ? &(*link)->left : &(*link)->right;
+    }
+    if (*link == NULL)
+        return (0);
+
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
+    for (up = sg_unlink(link); up != NULL; up = up->parent)
+        BT_UPDATE(up);
+    tree->size--;
+    if (tree->size * SG_ALPHA_DEN < tree->max_size * SG_ALPHA_NUM &&
+        (tree->root == NULL || sg_rebuild(tree, tree->root, tree->size)))
+        tree->max_size = tree->size;
+
+    return (1);
+}
+
+/**
+ * sg_tree_delete - Frees a scapegoat tree
+ * @tree: Pointer to the scapegoat tree, left empty
+ */
+void sg_tree_delete(sg_tree_t *tree)
+{
+    if (tree == NULL)
+        return;
+
+    binary_tree_delete(tree->root);
+    tree->root = NULL;
+    tree->size = 0;
+    tree->max_size = 0;
+}
@@ -0,0 +1,144 @@
+#include "binary_trees.h"
+
+#ifndef BT_MULTISET
+#error "164-bst_multiset.c needs the count field, build with -DBT_MULTISET"
+#endif
+
+/**
+ * multi_insert_at - Adds one occurrence of a value below a node
+ * @tree: Double pointer to the link to descend from
+ * @parent: Node owning that link, NULL for the root
+ * @value: Value to add
+ * @changed: Set to 1 when a node is created or a count incremented
+ *
+ * Return: Pointer to the node holding the value, or NULL on failure
+ */
+static bst_t *multi_insert_at(bst_t **tree, bst_t *parent, int value,
+                              int *changed)
+{
+    bst_t *node;
+
+    if (*tree == NULL)
+    {
+        *tree = binary_tree_node(parent, value);
+        *changed = *tree != NULL;
+        return (*tree);
+    }
+
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
+    if (value < (*tree)->n)
+        node = multi_insert_at(&(*tree)->left, *tree, value, changed);
+    else if (BT_STAT_ADD(comparisons, 1), value > (*tree)->n)
+        node = multi_insert_at(&(*tree)->right, *tree, value, changed);
+    else
+    {
+        (*tree)->count++;
+        *changed = 1;
+        node = *tree;
+    }
+
+    /* The count is hashed with BT_MERKLE, so refresh the path either way */
+    if (*changed)
+        BT_UPDATE(*tree);
+    return (node);
+}
+
+/**
+ * bst_multi_insert - Adds one occurrence of a value to a multiset BST
+ * @tree: Double pointer to the root node of the BST
+ * @value: Value to add
+ *
+ * Description: a single descent either increments the count of the node
+ * holding the value or hangs a new node where the search ended, so
+ * repeated keys cost no node and no structural change.
+ *
+ * Return: Pointer to the node holding the value, or NULL on failure
+ */
+bst_t *bst_multi_insert(bst_t **tree, int value)
+{
+    int changed = 0;
+
+    if (tree == NULL)
+        return (NULL);
+
+    return (multi_insert_at(tree, NULL, value, &changed));
+}
+
+/**
+ * multi_remove_at - Removes one occurrence of a value below a node
+ * @root: Pointer to the root node of the subtree
+ * @value: Value to remove
+ * @removed: Set to 1 when a count is decremented or a node unlinked
+ *
+ * Return: Pointer to the new root node of the subtree
+ */
+static bst_t *multi_remove_at(bst_t *root, int value, int *removed)
+{
+    if (root == NULL)
+        return (NULL);
+
+    BT_STAT_ADD(visits, 1);
+    BT_STAT_ADD(comparisons, 1);
+    if (value < root->n)
+    {
+        root->left = multi_remove_at(root->left, value, removed);
+        if (root->left != NULL)
+            BT_SET_PARENT(root->left, root);
+    }
+    else if (BT_STAT_ADD(comparisons, 1), value > root->n)
+    {
+        root->right = multi_remove_at(root->right, value, removed);
+        if (root->right != NULL)
+            BT_SET_PARENT(root->right, root);
+    }
+    else
+    {
+        *removed = 1;
+        /* Last occurrence, bst_remove unlinks the node it starts at */
+        if (root->count == 1)
+            return (bst_remove(root, value));
+        root->count--;
+    }
+
+    /* The count is hashed with BT_MERKLE, so refresh the path either way */
+    if (*removed)
+        BT_UPDATE(root);
+    return (root);
+}
+
+/**
+ * bst_multi_remove - Removes one occurrence of a value from a multiset BST
+ * @tree: Double pointer to the root node of the BST
+ * @value: Value to remove
+ *
+ * Description: a single descent either decrements the count of the node
+ * holding the value or, on its last occurrence, unlinks the node.
+ *
+ * Return: 1 if an occurrence was removed, 0 if the value is absent
+ */
+int bst_multi_remove(bst_t **tree, int value)
+{
+    int removed = 0;
+
+    if (tree == NULL)
+        return (0);
+
+    *tree = multi_remove_at(*tree, value, &removed);
+
+    return (removed);
+}
+
+/**
+ * bst_count - Counts the occurrences of a value in a multiset BST
+ * @tree: Pointer to the root node of the BST
+ * @value: Value to count
+ *
+ * Return: Number of occurrences, 0 if the value is absent
+ */
+size_t bst_count(const bst_t *tree, int value)
+{
+    const bst_t *node = bst_search(tree, value);
+
+    return (node != NULL ? node->count : 0);
+}
@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point, build with -DBT_MULTISET
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2, 47, 47, 68, 2, 79, 47
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    printf("Nodes: %lu for %lu values\n", (unsigned long)binary_tree_size(tree),
+           (unsigned long)n);
+    printf("Count of 47: %lu, of 2: %lu, of 5: %lu\n",
+           (unsigned long)bst_count(tree, 47), (unsigned long)bst_count(tree, 2),
+           (unsigned long)bst_count(tree, 5));
+
+    bst_multi_remove(&tree, 47);
+    bst_multi_remove(&tree, 21);
+    bst_multi_insert(&tree, 2);
+    printf("After removing 47 and 21 once, adding 2: %lu, %lu, %lu\n",
+           (unsigned long)bst_count(tree, 47), (unsigned long)bst_count(tree, 21),
+           (unsigned long)bst_count(tree, 2));
+
+    while (bst_multi_remove(&tree, 47))
+        ;
+    printf("After removing every 47: %lu nodes\n",
+           (unsigned long)binary_tree_size(tree));
+    binary_tree_delete(tree);
+    return (0);
+}
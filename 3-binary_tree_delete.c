@@ -17,6 +17,6 @@ void binary_tree_delete(binary_tree_t *tree)
     binary_tree_delete(tree->right);
 
     /* Free the current node */
-    free(tree);
+    binary_tree_node_free(tree);
 }
 
@@ -9,20 +9,203 @@
  * struct binary_tree_s - Binary tree node
  *
  * @n: Integer stored in the node
- * @parent: Pointer to the parent node
+ * @height: Height of the subtree rooted here, 1 for a leaf
+ * @deleted: Set when the value was lazily removed (BT_TOMBSTONE only)
+ * @parent: Pointer to the parent node (absent when built with BT_NO_PARENT)
  * @left: Pointer to the left child node
  * @right: Pointer to the right child node
+ * @size: Number of nodes in the subtree rooted here (BT_ORDER_STATS only)
+ * @hash: Hash of the subtree rooted here (BT_MERKLE only)
+ * @count: Number of occurrences of @n (BT_MULTISET only)
+ *
+ * Description: compiling with -DBT_NO_PARENT drops @parent, shrinking a
+ * node from 32 to 24 bytes on LP64. Only the functions that never walk
+ * upwards are available in that mode: node creation/deletion, traversals,
+ * measures, bst_insert, array_to_bst, bst_search and bst_remove.
+ * @height fills the padding after @n, so it costs no memory in either
+ * layout; it is kept by the functions that call BT_UPDATE.
  */
 typedef struct binary_tree_s
 {
     int n;
+#ifdef BT_TOMBSTONE
+    int height : 31;
+    unsigned int deleted : 1;
+#else
+    int height;
+#endif
+#ifndef BT_NO_PARENT
     struct binary_tree_s *parent;
+#endif
     struct binary_tree_s *left;
     struct binary_tree_s *right;
+#ifdef BT_ORDER_STATS
+    size_t size;
+#endif
+#ifdef BT_MERKLE
+    unsigned long hash;
+#endif
+#ifdef BT_MULTISET
+    size_t count;
+#endif
 } binary_tree_t;
 
+/* Parent link accessors, no-ops when the node has no parent field */
+#ifndef BT_NO_PARENT
+#define BT_SET_PARENT(node, p) ((node)->parent = (p))
+#else
+#define BT_SET_PARENT(node, p) ((void)(node), (void)(p))
+#endif
+
+/* Subtree size, O(1) with BT_ORDER_STATS, a full count otherwise */
+#ifdef BT_ORDER_STATS
+#define BT_SIZE(t) ((t) != NULL ? (t)->size : 0)
+#define BT_UPDATE_SIZE(t) \
+    ((t)->size = 1 + BT_SIZE((t)->left) + BT_SIZE((t)->right))
+#else
+#define BT_SIZE(t) binary_tree_size(t)
+#define BT_UPDATE_SIZE(t) ((void)(t))
+#endif
+
+/* Subtree height, kept in every node */
+#define BT_HEIGHT(t) ((t) != NULL ? (t)->height : 0)
+#define BT_UPDATE_HEIGHT(t) ((t)->height = 1 + \
+    (BT_HEIGHT((t)->left) > BT_HEIGHT((t)->right) ? \
+     BT_HEIGHT((t)->left) : BT_HEIGHT((t)->right)))
+
+/* Per-node state besides the value that the subtree hash covers */
+#if defined(BT_TOMBSTONE) && defined(BT_MULTISET)
+#define BT_HASH_STATE(t) ((unsigned long)(t)->count << 1 | (t)->deleted)
+#elif defined(BT_TOMBSTONE)
+#define BT_HASH_STATE(t) ((unsigned long)(t)->deleted)
+#elif defined(BT_MULTISET)
+#define BT_HASH_STATE(t) ((unsigned long)(t)->count)
+#else
+#define BT_HASH_STATE(t) 0UL
+#endif
+
+/* Subtree hash, of the node and both child hashes, with BT_MERKLE */
+#ifdef BT_MERKLE
+#define BT_HASH(t) ((t) != NULL ? (t)->hash : 0UL)
+#define BT_UPDATE_HASH(t) ((t)->hash = bt_merkle_hash((t)->n, \
+    BT_HASH_STATE(t), BT_HASH((t)->left), BT_HASH((t)->right)))
+#else
+#define BT_UPDATE_HASH(t) ((void)(t))
+#endif
+
+/*
+ * BT_UPDATE - Recomputes the augmented fields of a node from its children.
+ * Every function that changes the shape below a node calls it on the way
+ * back up. The height is always kept; size and hash only when enabled.
+ */
+#define BT_UPDATE(t) \
+    (BT_UPDATE_HEIGHT(t), BT_UPDATE_SIZE(t), BT_UPDATE_HASH(t))
+
+/*
+ * HEAP_HIGHER - Order of heap_t and heap_mq_t, true when a must sit above b.
+ * Max-heap by default, min-heap with -DHEAP_MIN; any other order can be
+ * given with -D'HEAP_HIGHER(a, b)=...'. It is expanded in place, so the
+ * order costs no indirect call.
+ */
+#ifndef HEAP_HIGHER
+#ifdef HEAP_MIN
+#define HEAP_HIGHER(a, b) ((a) < (b))
+#else
+#define HEAP_HIGHER(a, b) ((a) > (b))
+#endif
+#endif
+
+/**
+ * struct bt_stats_s - Operation counters of the calling thread (BT_STATS)
+ *
+ * @comparisons: Key comparisons made by searches, inserts and removals
+ * @visits: Nodes visited by searches, inserts and removals
+ * @rotations: Rotations performed
+ * @allocs: Nodes allocated by binary_tree_node
+ * @frees: Nodes released by binary_tree_node_free
+ * @max_depth: Deepest node reached by a search or an insertion, root is 1
+ */
+typedef struct bt_stats_s
+{
+    unsigned long comparisons;
+    unsigned long visits;
+    unsigned long rotations;
+    unsigned long allocs;
+    unsigned long frees;
+    size_t max_depth;
+} bt_stats_t;
+
+/*
+ * Counter hooks, they compile to nothing unless built with -DBT_STATS.
+ * BT_STAT_DEPTH takes the depth of the node reached, root is 1, as counted
+ * by the descent the caller already makes.
+ */
+#ifdef BT_STATS
+extern __thread bt_stats_t bt_stats;
+#define BT_STAT_ADD(field, k) (bt_stats.field += (k))
+#define BT_STAT_DEPTH(d) ((d) > bt_stats.max_depth ? \
+                          (void)(bt_stats.max_depth = (d)) : (void)0)
+#else
+#define BT_STAT_ADD(field, k) ((void)0)
+#define BT_STAT_DEPTH(d) ((void)(d))
+#endif
+
+/**
+ * enum bt_op_e - Operations timed by the bt_timed_* wrappers
+ *
+ * @BT_OP_BST_INSERT: bst_insert
+ * @BT_OP_BST_SEARCH: bst_search
+ * @BT_OP_BST_REMOVE: bst_remove
+ * @BT_OP_AVL_INSERT: avl_insert
+ * @BT_OP_HEAP_INSERT: heap_insert
+ * @BT_OP_HEAP_EXTRACT: heap_extract
+ * @BT_OP_COUNT: Number of timed operations
+ */
+typedef enum bt_op_e
+{
+    BT_OP_BST_INSERT,
+    BT_OP_BST_SEARCH,
+    BT_OP_BST_REMOVE,
+    BT_OP_AVL_INSERT,
+    BT_OP_HEAP_INSERT,
+    BT_OP_HEAP_EXTRACT,
+    BT_OP_COUNT
+} bt_op_t;
+
+/* Latency buckets: four per power of two of the cycle count */
+#define BT_TIMING_BUCKETS 256
+
+/* Trace hook, called with the operation and its duration in cycles */
+typedef void (*bt_trace_hook_t)(bt_op_t op, unsigned long cycles, void *ctx);
+
 /* Prototypes */
+unsigned long bt_cycles(void);
+void bt_timing_record(bt_op_t op, unsigned long cycles);
+void bt_timing_set_hook(unsigned long threshold, bt_trace_hook_t hook,
+                        void *ctx);
+void bt_timing_reset(void);
+unsigned long bt_timing_count(bt_op_t op);
+unsigned long bt_timing_percentile(bt_op_t op, double percent);
+const char *bt_op_name(bt_op_t op);
+void bt_timing_print(void);
+
+void bt_stats_snapshot(bt_stats_t *stats);
+void bt_stats_reset(void);
+
+unsigned long bt_merkle_hash(int n, unsigned long state, unsigned long left,
+                             unsigned long right);
+int bt_merkle_equal(const binary_tree_t *a, const binary_tree_t *b);
+size_t bt_merkle_diff(const binary_tree_t *a, const binary_tree_t *b,
+                      void (*func)(const binary_tree_t *,
+                                   const binary_tree_t *));
+
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
+void binary_tree_node_free(binary_tree_t *node);
+
+/* Per-thread node caches (BT_NODE_CACHE), nodes move in batches this big */
+#define BT_CACHE_BATCH 64
+binary_tree_t *binary_tree_cache_alloc(void);
+void binary_tree_cache_free(binary_tree_t *node);
 
 binary_tree_t *binary_tree_insert_left(binary_tree_t *parent, int value);
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
@@ -107,6 +290,49 @@ void binary_tree_print(const binary_tree_t *);
 /* Binary Search Tree Node Structure */
 typedef struct binary_tree_s bst_t;
 
+/**
+ * struct bst_lazy_s - BST with lazy deletion (BT_TOMBSTONE)
+ *
+ * @root: Root of the tree, tombstones included
+ * @live: Number of values present
+ * @dead: Number of tombstones
+ * @ratio: Percentage of tombstones in the tree that triggers compaction,
+ *         0 to only compact on request
+ */
+typedef struct bst_lazy_s
+{
+    bst_t *root;
+    size_t live;
+    size_t dead;
+    unsigned int ratio;
+} bst_lazy_t;
+
+/* Default compaction threshold of bst_lazy_init, in percent */
+#define BST_LAZY_RATIO 25
+
+/**
+ * struct sg_tree_s - Scapegoat tree, a BST balanced by partial rebuilds
+ *
+ * @root: Root of the tree
+ * @size: Number of nodes
+ * @max_size: Largest @size since the last full rebuild
+ *
+ * Description: a plain BST whose depth stays below log_{1/alpha}(size);
+ * balance is restored by rebuilding the subtree of an alpha-weight
+ * unbalanced ancestor. Nothing beyond the tree itself is stored per node.
+ * Use bst_search on @root for lookups. Zero-initialise to start empty.
+ */
+typedef struct sg_tree_s
+{
+    bst_t *root;
+    size_t size;
+    size_t max_size;
+} sg_tree_t;
+
+/* Weight balance alpha = SG_ALPHA_NUM / SG_ALPHA_DEN, between 1/2 and 1 */
+#define SG_ALPHA_NUM 2
+#define SG_ALPHA_DEN 3
+
 /* Function Prototypes */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
 bst_t *bst_insert(bst_t **tree, int value);
@@ -119,6 +345,42 @@ void binary_tree_print(const binary_tree_t *);
 bst_t *bst_search(const bst_t *tree, int value);
 
 bst_t *bst_remove(bst_t *root, int value);
+size_t bst_insert_sorted_batch(bst_t **tree, const int *keys, size_t n);
+size_t bst_flatten(bst_t *tree, bst_t **nodes);
+bst_t *bst_build_balanced(bst_t **nodes, size_t n);
+
+void bst_lazy_init(bst_lazy_t *tree);
+bst_t *bst_lazy_insert(bst_lazy_t *tree, int value);
+bst_t *bst_lazy_search(const bst_lazy_t *tree, int value);
+int bst_lazy_remove(bst_lazy_t *tree, int value);
+int bst_lazy_compact(bst_lazy_t *tree);
+void bst_lazy_inorder(const bst_lazy_t *tree, void (*func)(int));
+void bst_lazy_delete(bst_lazy_t *tree);
+
+bst_t *sg_tree_insert(sg_tree_t *tree, int value);
+int sg_tree_remove(sg_tree_t *tree, int value);
+void sg_tree_delete(sg_tree_t *tree);
+
+bst_t *bst_multi_insert(bst_t **tree, int value);
+int bst_multi_remove(bst_t **tree, int value);
+size_t bst_count(const bst_t *tree, int value);
+
+/* Treap on bst_t, priorities derived from the key and a secret seed */
+void treap_seed(unsigned long seed);
+unsigned long treap_priority(int value);
+bst_t *treap_insert(bst_t **tree, int value);
+bst_t *treap_remove(bst_t *root, int value);
+void treap_split(bst_t *tree, int key, bst_t **lo, bst_t **hi);
+bst_t *treap_merge(bst_t *lo, bst_t *hi);
+
+/* Self-adjusting lookup, splays the accessed node to the root */
+bst_t *bst_splay(bst_t *node);
+bst_t *bst_splay_search(bst_t **tree, int value);
+
+/* Order statistics, O(log n) on balanced trees with BT_ORDER_STATS */
+bst_t *bst_select(const bst_t *tree, size_t k);
+size_t bst_rank(const bst_t *tree, int value);
+bst_t *bst_percentile(const bst_t *tree, double percent);
 
 int binary_tree_is_avl(const binary_tree_t *tree);
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value); 
@@ -142,12 +404,158 @@ heap_t *array_to_heap(int *array, size_t size);
 void heapify(heap_t *node);
 heap_t *heap_insert(heap_t **root, int value);
 int heap_extract(heap_t **root);
+size_t heap_size(const heap_t *root);
+heap_t *heap_node_at(heap_t *root, size_t index);
+void heap_swap_up(heap_t **root, heap_t *node);
+heap_t *heapify_up(heap_t **root, heap_t *node);
+void heapify_down(heap_t **root, heap_t *node);
+heap_t *heap_update_key(heap_t **root, heap_t *node, int value);
+int heap_remove(heap_t **root, heap_t *node);
+int *heap_to_sorted_array(heap_t *heap, size_t *size);
+heap_t *heap_meld(heap_t *a, heap_t *b);
+heap_t *meld_heap_insert(heap_t **root, int value);
+int meld_heap_extract(heap_t **root);
+
+/* Timed entry points, same contract as the functions they wrap */
+bst_t *bt_timed_bst_insert(bst_t **tree, int value);
+bst_t *bt_timed_bst_search(const bst_t *tree, int value);
+bst_t *bt_timed_bst_remove(bst_t *root, int value);
+binary_tree_t *bt_timed_avl_insert(binary_tree_t **tree, int value);
+heap_t *bt_timed_heap_insert(heap_t **root, int value);
+int bt_timed_heap_extract(heap_t **root);
 void binary_tree_print(const binary_tree_t *tree);
 void binary_tree_delete(binary_tree_t *tree);
 
+/**
+ * struct pbst_s - Node of a persistent (path-copying) AVL tree
+ *
+ * @n: Integer stored in the node
+ * @height: Height of the subtree rooted here, a leaf has height 1
+ * @refs: Number of versions and parent nodes referencing this node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ *
+ * Description: nodes are never modified once built. An update copies the
+ * path from the root to the change and shares every other subtree with
+ * the previous version, so keeping a version is an O(1) pbst_retain.
+ */
+typedef struct pbst_s
+{
+    int n;
+    int height;
+    unsigned long refs;
+    struct pbst_s *left;
+    struct pbst_s *right;
+} pbst_t;
+
+pbst_t *pbst_retain(pbst_t *tree);
+void pbst_release(pbst_t *tree);
+const pbst_t *pbst_search(const pbst_t *tree, int value);
+void pbst_inorder(const pbst_t *tree, void (*func)(int));
+int pbst_insert(pbst_t *tree, int value, pbst_t **out);
+int pbst_remove(pbst_t *tree, int value, pbst_t **out);
+
+/* Keys per B+ tree node, with the count and child pointer in 64 bytes */
+#define BTREE_ORDER 13
+/* Ints covered by the in-node compares, the whole 64-byte node */
+#define BTREE_LINE 16
+/* Minimum fill of a non-root node */
+#define BTREE_MIN(node) ((node)->leaf ? BTREE_ORDER / 2 : (BTREE_ORDER - 1) / 2)
+
+/**
+ * struct btree_node_s - Node of a B+ tree of integers, one cache line
+ *
+ * @keys: Sorted keys; in an internal node keys[i] separates children[i]
+ *        (smaller) from children[i + 1]
+ * @count: Number of keys in use
+ * @leaf: 1 for a leaf, 0 for an internal node
+ * @children: Internal nodes only, group of BTREE_ORDER + 1 node slots
+ *            holding the children contiguously, NULL in a leaf
+ *
+ * Description: as in a CSB+ tree, a node stores a single pointer to its
+ * children, so keys, count and link share one line and a descent reads
+ * one line per level. Groups are allocated at full capacity, so splits,
+ * merges and borrows only move nodes inside them.
+ */
+typedef struct btree_node_s
+{
+    int keys[BTREE_ORDER];
+    unsigned short count;
+    unsigned short leaf;
+    struct btree_node_s *children;
+} __attribute__((aligned(64))) btree_node_t;
+
+/**
+ * struct btree_s - B+ tree of integers
+ *
+ * @root: Root node, NULL when the tree is empty
+ * @size: Number of keys stored
+ */
+typedef struct btree_s
+{
+    btree_node_t *root;
+    size_t size;
+} btree_t;
+
+/**
+ * struct heap_topk_s - Bounded heap keeping the k highest values seen
+ *
+ * @array: Kept values, a heap whose root is the lowest of them
+ * @size: Number of values in @array
+ * @k: Capacity of @array
+ *
+ * Description: "highest" follows HEAP_HIGHER, so with -DHEAP_MIN the k
+ * lowest values are kept.
+ */
+typedef struct heap_topk_s
+{
+    int *array;
+    size_t size;
+    size_t k;
+} heap_topk_t;
+
+/**
+ * struct heap_iter_s - Pull iterator yielding a heap in heap order
+ *
+ * @root: Heap drained by heap_extract, NULL in non-destructive mode
+ * @frontier: Nodes whose parent was yielded, a heap of pointers
+ * @size: Number of entries in @frontier
+ * @capacity: Number of slots allocated in @frontier
+ */
+typedef struct heap_iter_s
+{
+    heap_t **root;
+    const heap_t **frontier;
+    size_t size;
+    size_t capacity;
+} heap_iter_t;
+
+unsigned int btree_node_lower(const btree_node_t *node, int value);
+unsigned int btree_node_child(const btree_node_t *node, int value);
+int btree_search(const btree_t *tree, int value);
+size_t btree_range(const btree_t *tree, int lo, int hi, void (*func)(int));
+int btree_insert(btree_t *tree, int value);
+int btree_remove(btree_t *tree, int value);
+void btree_delete(btree_t *tree);
+
+int heap_topk_init(heap_topk_t *topk, size_t k);
+void heap_topk_free(heap_topk_t *topk);
+int heap_topk_push(heap_topk_t *topk, int value);
+size_t heap_topk_result(const heap_topk_t *topk, int *out);
+void heap_topk_merge(heap_topk_t *dst, const heap_topk_t *src);
+
+int heap_iter_init(heap_iter_t *it, heap_t **root, int keep);
+int heap_iter_next(heap_iter_t *it, int *value);
+void heap_iter_free(heap_iter_t *it);
+
 /* AVL Tree Structure */
 typedef struct binary_tree_s avl_t;
 
+/* Set operations split work across threads while the second operand is
+ * taller than AVL_SET_PAR_HEIGHT, down to AVL_SET_PAR_DEPTH levels */
+#define AVL_SET_PAR_HEIGHT 12
+#define AVL_SET_PAR_DEPTH 3
+
 /* Function Prototypes */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
 void binary_tree_print(const binary_tree_t *);
@@ -155,6 +563,15 @@ void binary_tree_print(const binary_tree_t *);
 /* AVL Tree Specific Functions */
 avl_t *array_to_avl(int *array, size_t size);
 avl_t *avl_insert(avl_t **tree, int value);
+avl_t *avl_rebalance(avl_t *node);
+avl_t *avl_join3(avl_t *lo, avl_t *mid, avl_t *hi);
+avl_t *avl_join2(avl_t *lo, avl_t *hi);
+avl_t *avl_split3(avl_t *tree, int key, avl_t **lo, avl_t **hi);
+void avl_split(avl_t *tree, int key, avl_t **lo, avl_t **hi);
+avl_t *avl_join(avl_t *lo, avl_t *hi);
+avl_t *avl_union(avl_t *a, avl_t *b);
+avl_t *avl_intersection(avl_t *a, avl_t *b);
+avl_t *avl_difference(avl_t *a, avl_t *b);
 int binary_tree_balance(const binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree);
@@ -0,0 +1,143 @@
+#ifndef BINARY_TREES_CONCURRENT_H
+#define BINARY_TREES_CONCURRENT_H
+
+/* Libraries */
+#include <stddef.h>
+#include <pthread.h>
+#include "binary_trees.h"
+
+#ifdef BT_NO_PARENT
+#error "the concurrent structures need the parent link, drop BT_NO_PARENT"
+#endif
+
+/* Size of a cache line, used to keep per-thread slots apart */
+#define BT_CACHE_LINE 64
+
+/* Maximum number of reader threads registered at once on one cbst_t */
+#define CBST_MAX_READERS 64
+/* Number of unlinked nodes kept before a writer waits for readers */
+#define CBST_RETIRE_BATCH 64
+
+/* Structures */
+/**
+ * struct cbst_reader_s - Per-reader epoch slot
+ *
+ * @epoch: Epoch observed when the read section began, 0 when quiescent
+ * @used: 1 while a thread holds the slot through cbst_reader_register
+ *
+ * Description: one slot per reader thread, each on its own cache line so
+ * that entering and leaving a read section never bounces a shared line.
+ */
+typedef struct cbst_reader_s
+{
+    unsigned long epoch;
+    int used;
+} __attribute__((aligned(BT_CACHE_LINE))) cbst_reader_t;
+
+/**
+ * struct cbst_s - Concurrent Binary Search Tree
+ *
+ * @root: Root of the tree, published with release stores
+ * @lock: Serialises writers, never taken by readers
+ * @epoch: Global epoch, advanced by writers before reclaiming nodes
+ * @retired: Unlinked nodes waiting for readers, chained through @parent
+ * @n_retired: Number of nodes in @retired
+ * @readers: Epoch slots of the reader threads
+ *
+ * Description: readers bracket lookups with cbst_read_lock/unlock and never
+ * block. Writers never modify the value of a reachable node; removals
+ * unlink, or replace by a copy, and retire the old nodes, which are freed
+ * once every reader that could still see them has left its read section.
+ */
+typedef struct cbst_s
+{
+    bst_t *root;
+    pthread_mutex_t lock;
+    unsigned long epoch;
+    bst_t *retired;
+    size_t n_retired;
+    cbst_reader_t readers[CBST_MAX_READERS];
+} cbst_t;
+
+/**
+ * struct heap_mq_queue_s - One sub-queue of a concurrent priority queue
+ *
+ * @lock: Protects the fields below
+ * @array: Heap ordered by HEAP_HIGHER, stored in level order
+ * @size: Number of values in @array, readable without @lock
+ * @capacity: Number of slots allocated in @array
+ * @top: Copy of array[0], readable without @lock
+ */
+typedef struct heap_mq_queue_s
+{
+    pthread_mutex_t lock;
+    int *array;
+    size_t size;
+    size_t capacity;
+    int top;
+} __attribute__((aligned(BT_CACHE_LINE))) heap_mq_queue_t;
+
+/**
+ * struct heap_mq_s - Relaxed concurrent priority queue (MultiQueue)
+ *
+ * @queues: Array of independently locked heaps
+ * @nb_queues: Number of entries in @queues, about twice the thread count
+ *
+ * Description: heap_mq_insert pushes into a random sub-queue and
+ * heap_mq_extract pops the HEAP_HIGHER of the tops of two random
+ * sub-queues, so threads rarely meet on the same lock. Extraction order is relaxed: the value
+ * returned is close to, but not always, the global top.
+ */
+typedef struct heap_mq_s
+{
+    heap_mq_queue_t *queues;
+    size_t nb_queues;
+} heap_mq_t;
+
+/**
+ * struct pbst_cell_s - Shared current version of a persistent AVL tree
+ *
+ * @root: Current version, owned by the cell
+ * @gen: Generation new readers count themselves in, 0 or 1
+ * @readers: Per generation, number of readers between loading @root and
+ *           retaining it, on a line of their own so @root stays clean
+ *
+ * Description: readers take snapshots without locks. A writer publishing
+ * a new version flips @gen, then waits only for the readers of the old
+ * generation to leave that two-step window before releasing the previous
+ * version; readers arriving meanwhile count in the new generation, so a
+ * steady stream of snapshots cannot hold the writer back.
+ */
+typedef struct pbst_cell_s
+{
+    pbst_t *root;
+    unsigned long gen;
+    unsigned long readers[2] __attribute__((aligned(BT_CACHE_LINE)));
+} pbst_cell_t;
+
+/* Function Prototypes */
+int cbst_init(cbst_t *tree);
+void cbst_destroy(cbst_t *tree);
+void cbst_synchronize(cbst_t *tree);
+void cbst_retire(cbst_t *tree, bst_t *node);
+
+int cbst_reader_register(cbst_t *tree);
+void cbst_reader_unregister(cbst_t *tree, size_t reader);
+int cbst_read_lock(cbst_t *tree, size_t reader);
+void cbst_read_unlock(cbst_t *tree, size_t reader);
+const bst_t *cbst_search(const cbst_t *tree, int value);
+
+int cbst_insert(cbst_t *tree, int value);
+int cbst_remove(cbst_t *tree, int value);
+
+pbst_t *pbst_snapshot(pbst_cell_t *cell);
+void pbst_publish(pbst_cell_t *cell, pbst_t *root);
+
+int heap_mq_init(heap_mq_t *mq, size_t nb_queues);
+void heap_mq_destroy(heap_mq_t *mq);
+int heap_mq_push(heap_mq_queue_t *queue, int value);
+int heap_mq_pop(heap_mq_queue_t *queue);
+int heap_mq_insert(heap_mq_t *mq, int value);
+int heap_mq_extract(heap_mq_t *mq, int *value);
+
+#endif /* BINARY_TREES_CONCURRENT_H */
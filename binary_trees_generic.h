@@ -0,0 +1,285 @@
+#ifndef BINARY_TREES_GENERIC_H
+#define BINARY_TREES_GENERIC_H
+
+/* Libraries */
+#include <stdlib.h>
+
+/*
+ * Key-type generic tree and heap families.
+ *
+ * Each BT_DEFINE_* macro expands to a node type and a set of static
+ * functions specialised for one key type and one ordering. The ordering is
+ * a macro (or static function) expanded in place, so no comparison goes
+ * through a function pointer. The int binary_tree_t family in
+ * binary_trees.h is left untouched.
+ *
+ * Usage:
+ *     #define ID_LESS(a, b) ((a) < (b))
+ *     BT_DEFINE_BST(id_bst, unsigned long, ID_LESS)
+ *     BT_DEFINE_HEAP(id_heap, unsigned long, BT_GREATER)
+ *     BT_DEFINE_MIN_HEAP(timer_heap, unsigned long)
+ */
+
+#ifdef __GNUC__
+#define BT_GENERIC_FN static __attribute__((unused))
+#else
+#define BT_GENERIC_FN static
+#endif
+
+/* Ready-made orderings for scalar keys */
+#define BT_LESS(a, b) ((a) < (b))
+#define BT_GREATER(a, b) ((a) > (b))
+
+/**
+ * BT_DEFINE_BST - Generates a Binary Search Tree family
+ * @name: Prefix of the generated type and functions
+ * @key_t: Key type stored in the nodes
+ * @less: Strict ordering, less(a, b) is true when a sorts before b
+ *
+ * Description: generates
+ *   name##_t                               node (n, parent, left, right)
+ *   name##_t *name##_node(parent, value)   creates a node
+ *   name##_t *name##_insert(&tree, value)  NULL on duplicate or failure
+ *   name##_t *name##_search(tree, value)   NULL if absent
+ *   name##_t *name##_remove(root, value)   returns the new root
+ *   void name##_delete(tree)               frees the whole tree
+ */
+#define BT_DEFINE_BST(name, key_t, less)                                      \
+typedef struct name##_s                                                       \
+{                                                                             \
+    key_t n;                                                                  \
+    struct name##_s *parent;                                                  \
+    struct name##_s *left;                                                    \
+    struct name##_s *right;                                                   \
+} name##_t;                                                                   \
+                                                                              \
+BT_GENERIC_FN name##_t *name##_node(name##_t *parent, key_t value)            \
+{                                                                             \
+    name##_t *new_node = malloc(sizeof(name##_t));                            \
+                                                                              \
+    if (new_node == NULL)                                                     \
+        return (NULL);                                                        \
+    new_node->n = value;                                                      \
+    new_node->parent = parent;                                                \
+    new_node->left = NULL;                                                    \
+    new_node->right = NULL;                                                   \
+    return (new_node);                                                        \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN name##_t *name##_insert(name##_t **tree, key_t value)           \
+{                                                                             \
+    name##_t *parent = NULL, **link = tree;                                   \
+                                                                              \
+    if (tree == NULL)                                                         \
+        return (NULL);                                                        \
+    while (*link != NULL)                                                     \
+    {                                                                         \
+        parent = *link;                                                       \
+        if (less(value, parent->n))                                           \
+            link = &parent->left;                                             \
+        else if (less(parent->n, value))                                      \
+            link = &parent->right;                                            \
+        else                                                                  \
+            return (NULL);                                                    \
+    }                                                                         \
+    *link = name##_node(parent, value);                                       \
+    return (*link);                                                           \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN name##_t *name##_search(const name##_t *tree, key_t value)      \
+{                                                                             \
+    while (tree != NULL)                                                      \
+    {                                                                         \
+        if (less(value, tree->n))                                             \
+            tree = tree->left;                                                \
+        else if (less(tree->n, value))                                        \
+            tree = tree->right;                                               \
+        else                                                                  \
+            return ((name##_t *)tree);                                        \
+    }                                                                         \
+    return (NULL);                                                            \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN name##_t *name##_remove(name##_t *root, key_t value)            \
+{                                                                             \
+    name##_t **link = &root, *node, *child, *succ;                            \
+                                                                              \
+    while (*link != NULL && (less(value, (*link)->n) ||                       \
+                             less((*link)->n, value)))                        \
+        link = less(value, (*link)->n) ? &(*link)->left : &(*link)->right;    \
+    node = *link;                                                             \
+    if (node == NULL)                                                         \
+        return (root);                                                        \
+    if (node->left != NULL && node->right != NULL)                            \
+    {                                                                         \
+        link = &node->right;                                                  \
+        while ((*link)->left != NULL)                                         \
+            link = &(*link)->left;                                            \
+        succ = *link;                                                         \
+        node->n = succ->n;                                                    \
+        node = succ;                                                          \
+    }                                                                         \
+    child = node->left != NULL ? node->left : node->right;                    \
+    if (child != NULL)                                                        \
+        child->parent = node->parent;                                         \
+    *link = child;                                                            \
+    free(node);                                                               \
+    return (root);                                                            \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN void name##_delete(name##_t *tree)                              \
+{                                                                             \
+    if (tree == NULL)                                                         \
+        return;                                                               \
+    name##_delete(tree->left);                                                \
+    name##_delete(tree->right);                                               \
+    free(tree);                                                               \
+}
+
+/**
+ * BT_DEFINE_HEAP - Generates a complete-binary-tree heap family
+ * @name: Prefix of the generated type and functions
+ * @key_t: Key type stored in the nodes
+ * @higher: Heap order, higher(a, b) is true when a must sit above b
+ *          (BT_GREATER gives a max-heap, BT_LESS a min-heap)
+ *
+ * Description: generates
+ *   name##_t                                 node (n, parent, left, right)
+ *   size_t name##_size(root)                 O(log^2 n) on a complete tree
+ *   name##_t *name##_insert(&root, value)    NULL on failure
+ *   int name##_extract(&root, &value)        1 on success, 0 if empty
+ *   void name##_delete(root)                 frees the whole heap
+ * Nodes are addressed by their 1-based level-order index, so finding the
+ * insertion point or the last node costs O(log n) instead of a traversal.
+ */
+#define BT_DEFINE_HEAP(name, key_t, higher)                                   \
+typedef struct name##_s                                                       \
+{                                                                             \
+    key_t n;                                                                  \
+    struct name##_s *parent;                                                  \
+    struct name##_s *left;                                                    \
+    struct name##_s *right;                                                   \
+} name##_t;                                                                   \
+                                                                              \
+BT_GENERIC_FN size_t name##_size(const name##_t *root)                        \
+{                                                                             \
+    const name##_t *t;                                                        \
+    size_t size = 0, hl, hr;                                                  \
+                                                                              \
+    while (root != NULL)                                                      \
+    {                                                                         \
+        for (hl = 0, t = root->left; t != NULL; t = t->left)                  \
+            hl++;                                                             \
+        for (hr = 0, t = root->right; t != NULL; t = t->left)                 \
+            hr++;                                                             \
+        if (hl == hr)                                                         \
+        {                                                                     \
+            size += (size_t)1 << hl;                                          \
+            root = root->right;                                               \
+        }                                                                     \
+        else                                                                  \
+        {                                                                     \
+            size += (size_t)1 << hr;                                          \
+            root = root->left;                                                \
+        }                                                                     \
+    }                                                                         \
+    return (size);                                                            \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN name##_t *name##_at(name##_t *root, size_t index)               \
+{                                                                             \
+    size_t bit = 1;                                                           \
+                                                                              \
+    while (bit <= index >> 1)                                                 \
+        bit <<= 1;                                                            \
+    for (bit >>= 1; root != NULL && bit != 0; bit >>= 1)                      \
+        root = (index & bit) ? root->right : root->left;                      \
+    return (root);                                                            \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN name##_t *name##_insert(name##_t **root, key_t value)           \
+{                                                                             \
+    name##_t *node, *parent;                                                  \
+    size_t index;                                                             \
+    key_t tmp;                                                                \
+                                                                              \
+    if (root == NULL)                                                         \
+        return (NULL);                                                        \
+    node = malloc(sizeof(name##_t));                                          \
+    if (node == NULL)                                                         \
+        return (NULL);                                                        \
+    node->n = value;                                                          \
+    node->left = NULL;                                                        \
+    node->right = NULL;                                                       \
+    node->parent = NULL;                                                      \
+    if (*root == NULL)                                                        \
+        return (*root = node);                                                \
+    index = name##_size(*root) + 1;                                           \
+    parent = name##_at(*root, index >> 1);                                    \
+    node->parent = parent;                                                    \
+    if (index & 1)                                                            \
+        parent->right = node;                                                 \
+    else                                                                      \
+        parent->left = node;                                                  \
+    while (node->parent != NULL && higher(node->n, node->parent->n))          \
+    {                                                                         \
+        tmp = node->n;                                                        \
+        node->n = node->parent->n;                                            \
+        node->parent->n = tmp;                                                \
+        node = node->parent;                                                  \
+    }                                                                         \
+    return (node);                                                            \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN int name##_extract(name##_t **root, key_t *value)               \
+{                                                                             \
+    name##_t *last, *node, *best;                                             \
+    key_t tmp;                                                                \
+                                                                              \
+    if (root == NULL || *root == NULL)                                        \
+        return (0);                                                           \
+    if (value != NULL)                                                        \
+        *value = (*root)->n;                                                  \
+    last = name##_at(*root, name##_size(*root));                              \
+    if (last == *root)                                                        \
+    {                                                                         \
+        free(last);                                                           \
+        *root = NULL;                                                         \
+        return (1);                                                           \
+    }                                                                         \
+    (*root)->n = last->n;                                                     \
+    if (last->parent->right == last)                                          \
+        last->parent->right = NULL;                                           \
+    else                                                                      \
+        last->parent->left = NULL;                                            \
+    free(last);                                                               \
+    for (node = *root; ; node = best)                                         \
+    {                                                                         \
+        best = node;                                                          \
+        if (node->left != NULL && higher(node->left->n, best->n))             \
+            best = node->left;                                                \
+        if (node->right != NULL && higher(node->right->n, best->n))           \
+            best = node->right;                                               \
+        if (best == node)                                                     \
+            break;                                                            \
+        tmp = node->n;                                                        \
+        node->n = best->n;                                                    \
+        best->n = tmp;                                                        \
+    }                                                                         \
+    return (1);                                                               \
+}                                                                             \
+                                                                              \
+BT_GENERIC_FN void name##_delete(name##_t *root)                              \
+{                                                                             \
+    if (root == NULL)                                                         \
+        return;                                                               \
+    name##_delete(root->left);                                                \
+    name##_delete(root->right);                                               \
+    free(root);                                                               \
+}
+
+/* Shorthands for scalar keys ordered by their built-in operators */
+#define BT_DEFINE_MIN_HEAP(name, key_t) BT_DEFINE_HEAP(name, key_t, BT_LESS)
+#define BT_DEFINE_MAX_HEAP(name, key_t) BT_DEFINE_HEAP(name, key_t, BT_GREATER)
+
+#endif /* BINARY_TREES_GENERIC_H */